@@ -3,11 +3,15 @@
 #include "logger.h"
 #include "unicode_latex.h"
 #include "string_utilities.h"
+#include "tex_citations.h"
+#include "bib_key_index.h"
 
 #include <cassert>
 #include <algorithm>
 #include <fstream>
-#include <regex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace string_utilities;
 
@@ -23,9 +27,41 @@ BibDatabase::~BibDatabase()
 		delete m;
 }
 
+void BibDatabase::ClearEntries()
+{
+	for (auto m : entries)
+		delete m;
+	entries.clear();
+	keyEntryMap.clear();
+}
+
+void BibDatabase::MoveItems(BibDatabase& other)
+{
+	// preambles, string abbreviations and comments; entries stay in the other database
+	preambles.insert(preambles.end(), other.preambles.begin(), other.preambles.end());
+	other.preambles.clear();
+	comments.insert(comments.end(), other.comments.begin(), other.comments.end());
+	other.comments.clear();
+
+	for (auto a : other.abbrv)
+	{
+		auto it = find_if(abbrv.begin(), abbrv.end(), [&](const BibAbbrv* b) { return b->getTag() == a->getTag(); });
+		if (it == abbrv.end())
+		{
+			abbrv.push_back(a);
+			macros->Define(a->getTag(), a->getValue());
+			continue;
+		}
+
+		Logger::Warning((*it)->getValue() == a->getValue(), "conflicting definitions of string abbreviation '" + a->getTag() + "'");
+		delete a;
+	}
+	other.abbrv.clear();
+}
+
 void BibDatabase::LogDetails() const
 {
-	int kb = int(double(inputFilesize)/1024.0 + 0.5);
+	long long kb = (long long)(double(inputFilesize)/1024.0 + 0.5);
 	string msg = "Successfully parsed " + (inputFilename != "" ? inputFilename : "stdin") + " (" + to_string(kb) + "KB): \n";
 	if (!preambles.empty())
 		msg += "  " + to_string(preambles.size()) + " preambles\n";
@@ -53,17 +89,21 @@ void BibDatabase::InitKeyEntryMap()
 	}
 }
 
-void BibDatabase::InitRefEntries() const
+void BibDatabase::InitRefEntries(bool partial) const
 {
 	for (auto entry: entries)
 	{
+		entry->refEntry = nullptr;
 		if (entry->fields.count("crossref"))
 		{
 			string ref = unquote(entry->fields["crossref"]);
 			string lref = to_lower(ref);
 			if (!keyEntryMap.count(lref))
 			{
-				Logger::Warning("non-existing crossref '" + ref + "' in " + entry->key);
+				if (partial)
+					Logger::Warning("crossref '" + ref + "' in " + entry->key + " is not in the same run; its fields are not inherited");
+				else
+					Logger::Warning("non-existing crossref '" + ref + "' in " + entry->key);
 			}
 			else
 			{
@@ -71,27 +111,66 @@ void BibDatabase::InitRefEntries() const
 			}
 		}
 	}
+
+	BuildCrossrefGraph();
 }
 
-void BibDatabase::CheckRequiredFields() const
+vector<BibEntry*> BibDatabase::BuildCrossrefGraph() const
 {
-	for (auto entry: entries)
+	// every entry has at most one parent, so the chains are followed once;
+	// parents precede their children in the resulting order
+	enum STATE {unvisited = 0, onPath = 1, done = 2};
+	unordered_map<const BibEntry*, int> state;
+	state.reserve(entries.size());
+
+	vector<BibEntry*> order;
+	order.reserve(entries.size());
+	for (auto entry : entries)
 	{
-		vector<string> required = BibEntry::GetRequiredFields(entry->type);
-		set<string> listed = entry->getFields();
-		for (string f : required)
+		if (state[entry] == done) continue;
+
+		vector<BibEntry*> path;
+		BibEntry* cur = entry;
+		while (cur != nullptr && state[cur] == unvisited)
+		{
+			state[cur] = onPath;
+			path.push_back(cur);
+			cur = cur->refEntry;
+		}
+
+		// a chain ending on the path is a cycle, which is broken at its last link
+		if (cur != nullptr && state[cur] == onPath)
+		{
+			string cycle;
+			for (int i = (int)(find(path.begin(), path.end(), cur) - path.begin()); i < (int)path.size(); i++)
+				cycle += path[i]->key + " -> ";
+			Logger::Warning("crossref cycle " + cycle + cur->key + "; removed crossref in " + path.back()->key);
+			path.back()->refEntry = nullptr;
+			path.back()->fields.erase("crossref");
+		}
+
+		// the inheritance table of an entry extends the one of its parent
+		for (int i = (int)path.size() - 1; i >= 0; i--)
 		{
-			vector<string> fs = split(f, "|");
-			bool fieldFound = false;
-			for (string s : fs)
-				fieldFound |= (listed.count(s) > 0);
+			BibEntry* e = path[i];
+			state[e] = done;
+			order.push_back(e);
 
-			Logger::Warning(fieldFound, "missing required field '" + f + "' in " + entry->key);
+			e->inherited.clear();
+			const BibEntry* parent = e->refEntry;
+			if (parent == nullptr) continue;
+
+			e->inherited = parent->inherited;
+			for (auto& f : parent->fields)
+				if (f.first != "crossref")
+					e->inherited[f.first] = parent;
 		}
 	}
+
+	return order;
 }
 
-void BibDatabase::ConvertFieldDelimeters(const string& option) const
+void BibDatabase::ConvertFieldDelimeters(BibEntry* en, const string& option) const
 {
 	assert(option == "braces" || option == "quotes");
 
@@ -101,90 +180,117 @@ void BibDatabase::ConvertFieldDelimeters(const string& option) const
 	else
 		openQ = '{', closeQ = '}';
 
-	for (auto en: entries)
+	for (auto field: en->fields)
 	{
-		for (auto field: en->fields)
-		{
-			string tag = field.first;
-			string value = field.second;
+		string tag = field.first;
+		string value = field.second;
 
-			string nvalue;
-			if (tag == "title")
-				nvalue = openQ + unquote(unquote(value)) + closeQ;
+		string nvalue;
+		if (tag == "title")
+			nvalue = openQ + unquote(unquote(value)) + closeQ;
+		else
+		{
+			string oldOQ, oldCQ;
+			string unq = unquote(value, oldOQ, oldCQ);
+			if ((oldOQ != "" && oldCQ != "") || (tag == "year"))
+				nvalue = openQ + unq + closeQ;
 			else
-			{
-				string oldOQ, oldCQ;
-				string unq = unquote(value, oldOQ, oldCQ);
-				if ((oldOQ != "" && oldCQ != "") || (tag == "year"))
-					nvalue = openQ + unq + closeQ;
-				else
-					nvalue = value;
-			}
-
-			en->fields[tag] = nvalue;
+				nvalue = value;
 		}
+
+		en->fields[tag] = nvalue;
 	}
 }
 
-void BibDatabase::ReplaceUnicodeCharacters() const
+void BibDatabase::ReplaceUnicodeCharacters(BibEntry* en) const
 {
-	for (auto en: entries)
+	for (auto& tag: en->fields)
 	{
-		for (auto tag: en->fields)
-		{
-			string key = tag.first;
-			string value = tag.second;
+		const string& value = tag.second;
+		if (unicode_latex::isAscii(value)) continue;
 
-			string nvalue = unicode_latex::transform(value);
-			if (value != nvalue)
-			{
-				en->fields[key] = nvalue;
-				Logger::Debug("replaced unicode characters in " + en->key + " for '" + key + "'");
-			}
+		string nvalue = unicode_latex::transform(value);
+		if (value != nvalue)
+		{
+			tag.second = nvalue;
+			Logger::Debug("replaced unicode characters in " + en->key + " for '" + tag.first + "'");
 		}
 	}
 }
 
-void BibDatabase::FixPagesDash() const
+void BibDatabase::ReplaceUnicodeInAbbreviations()
+{
+	for (auto a : abbrv)
+	{
+		if (unicode_latex::isAscii(a->value)) continue;
+
+		a->value = unicode_latex::transform(a->value);
+		macros->Define(a->tag, a->value);
+		Logger::Debug("replaced unicode characters in string abbreviation '" + a->tag + "'");
+	}
+}
+
+void BibDatabase::ReplaceLatexInAbbreviations()
+{
+	for (auto a : abbrv)
+	{
+		string value = unicode_latex::transformToUnicode(a->value);
+		if (value == a->value) continue;
+
+		a->value = value;
+		macros->Define(a->tag, a->value);
+		Logger::Debug("replaced latex commands in string abbreviation '" + a->tag + "'");
+	}
+}
+
+void BibDatabase::ReplaceLatexCommands(BibEntry* en) const
 {
-	for (auto en: entries)
+	for (auto& tag: en->fields)
 	{
-		string tag = "pages";
-		if (en->fields.count(tag))
+		const string& value = tag.second;
+		string nvalue = unicode_latex::transformToUnicode(value);
+		if (value != nvalue)
 		{
-			string value = en->fields[tag];
+			tag.second = nvalue;
+			Logger::Debug("replaced latex commands in " + en->key + " for '" + tag.first + "'");
+		}
+	}
+}
 
-			string openQ, closeQ;
-			string v = unquote(value, openQ, closeQ);
+void BibDatabase::FixPagesDash(BibEntry* en) const
+{
+	string tag = "pages";
+	if (en->fields.count(tag))
+	{
+		string value = en->fields[tag];
+
+		string openQ, closeQ;
+		string v = unquote(value, openQ, closeQ);
 
-			vector<string> tmp = split(v, " -");
-			if ((int)tmp.size() == 2 && isInteger(tmp[0]) && isInteger(tmp[1]))
+		vector<string> tmp = split(v, " -");
+		if ((int)tmp.size() == 2 && isInteger(tmp[0]) && isInteger(tmp[1]))
+		{
+			string nvalue = openQ + tmp[0] + "--" + tmp[1] + closeQ;
+			if (value != nvalue)
 			{
-				string nvalue = openQ + tmp[0] + "--" + tmp[1] + closeQ;
-				if (value != nvalue)
-				{
-					en->fields[tag] = nvalue;
-					Logger::Debug("fixed page dashes in " + en->key);
-				}
+				en->fields[tag] = nvalue;
+				Logger::Debug("fixed page dashes in " + en->key);
 			}
 		}
 	}
 }
 
-void BibDatabase::FixPadding() const
+void BibDatabase::FixPadding(BibEntry* entry) const
 {
-	for (auto entry: entries)
-	{
-		FixPadding(entry, "title");
-		FixPadding(entry, "journal");
-		FixPadding(entry, "booktitle");
-		FixPadding(entry, "publisher");
-		FixPadding(entry, "series");
-		FixPadding(entry, "address");
-		FixPadding(entry, "organization");
-		FixPadding(entry, "institution");
-		FixPadding(entry, "howpublished");
-	}
+	FixPadding(entry, "title");
+	FixPadding(entry, "journal");
+	FixPadding(entry, "booktitle");
+	FixPadding(entry, "publisher");
+	FixPadding(entry, "series");
+	FixPadding(entry, "address");
+	FixPadding(entry, "organization");
+	FixPadding(entry, "institution");
+	FixPadding(entry, "howpublished");
 }
 
 void BibDatabase::FixPadding(BibEntry* entry, const string& tag) const
@@ -209,211 +315,751 @@ void BibDatabase::FixPadding(BibEntry* entry, const string& tag) const
 	}
 }
 
-void BibDatabase::ConvertKeys(const string& option, const string& texFile)
+// the closest existing keys, appended to warnings about missing keys
+static string Suggestions(const BibKeyIndex& index, const string& key)
 {
-	assert(option == "alpha" || option == "abstract");
+	string res;
+	auto suggestions = index.Suggest(key, 3);
+	for (int i = 0; i < (int)suggestions.size(); i++)
+		res += (i == 0 ? "; did you mean " : ", ") + suggestions[i];
+	return (res == "" ? "" : res + "?");
+}
 
-	map<string, vector<BibEntry*> > key2Entries;
-	for (auto entry: entries)
+void BibDatabase::FilterCited(unordered_set<string>& cited, bool reportMissing)
+{
+	// "*" stands for all entries, as in \nocite{*}
+	if (cited.count("*")) return;
+
+	// crossref targets of the kept entries are kept too; they are added to the cited
+	// keys, so that targets in later chunks of a stream are found
+	bool added = true;
+	while (added)
+	{
+		added = false;
+		for (auto entry : entries)
+		{
+			if (!entry->fields.count("crossref") || !cited.count(to_lower(entry->key))) continue;
+
+			if (cited.insert(to_lower(unquote(entry->fields["crossref"]))).second)
+				added = true;
+		}
+	}
+
+	// suggestions for missing keys are taken from the whole database
+	if (reportMissing)
+	{
+		set<string> missing;
+		for (auto& key : cited)
+			if (!keyEntryMap.count(key))
+				missing.insert(key);
+
+		unique_ptr<BibKeyIndex> index;
+		if (!missing.empty())
+			index = BibKeyIndex::Create(keyEntryMap);
+		for (auto& key : missing)
+			Logger::Warning("cited key " + key + " not found in the database" + Suggestions(*index, key));
+	}
+
+	vector<BibEntry*> kept;
+	for (auto entry : entries)
 	{
-		if (!entry->fields.count("author")) 
+		string lkey = to_lower(entry->key);
+		if (cited.count(lkey))
 		{
-			key2Entries[entry->key].push_back(entry);
+			kept.push_back(entry);
 			continue;
 		}
 
-		string nvalue = GenerateKey(option, entry, entry->getAuthors());
-		key2Entries[nvalue].push_back(entry);
+		if (keyEntryMap.count(lkey) && keyEntryMap[lkey] == entry)
+			keyEntryMap.erase(lkey);
+		delete entry;
+	}
+
+	Logger::Debug("kept " + to_string(kept.size()) + " of " + to_string(entries.size()) + " entries");
+	entries.swap(kept);
+}
+
+void BibDatabase::FlattenCrossrefs()
+{
+	// inherited fields are copied from the nearest ancestors defining them
+	int count = 0;
+	for (auto entry : entries)
+	{
+		if (!entry->fields.count("crossref")) continue;
+
+		for (auto& f : entry->inherited)
+			if (!entry->fields.count(f.first))
+				entry->fields[f.first] = f.second->fields.find(f.first)->second;
+
+		entry->fields.erase("crossref");
+		entry->collationReady = false;
+		count++;
+	}
+
+	for (auto entry : entries)
+	{
+		entry->refEntry = nullptr;
+		entry->inherited.clear();
+	}
+
+	Logger::Debug("flattened " + to_string(count) + " crossrefs");
+}
+
+// suffixes a, b, ..., z, aa, ab, ...
+static string KeySuffix(int index)
+{
+	string res;
+	for (index++; index > 0; index = (index - 1) / 26)
+		res = char('a' + (index - 1) % 26) + res;
+	return res;
+}
+
+// initials of the significant words and the year, e.g. ICML2001
+static string VenueKey(const string& booktitle, const string& year)
+{
+	string res;
+	for (auto& word : split(unicode_latex::collationKey(booktitle), " "))
+	{
+		if (!isStopWord(word) && (int)res.length() < 8)
+			res += char(toupper((unsigned char)word[0]));
 	}
+	return (res == "" ? "Proc" : res) + trim(year);
+}
+
+void BibDatabase::FactorCrossrefs()
+{
+	// venue fields move to the parent; the year stays in the children too
+	static const string VENUE_FIELDS[] = {"booktitle", "editor", "publisher", "address", "organization", "series", "volume", "month", "year"};
 
-	for (auto it: key2Entries)
+	// entries are grouped by the values of their venue fields
+	unordered_map<string, vector<BibEntry*> > groups;
+	vector<string> order;
+	for (auto entry : entries)
 	{
-		string key = it.first;
-		vector<BibEntry*> entries = it.second;
-		for (int i = 0; i < (int)entries.size(); i++)
+		if (entry->type != "inproceedings" || entry->fields.count("crossref") || !entry->fields.count("booktitle")) continue;
+
+		string venue;
+		for (auto& tag : VENUE_FIELDS)
 		{
-			BibEntry* entry = entries[i];
-			string nvalue = key;
-			if (entries.size() > 1) nvalue += char('a' + i);
+			auto it = entry->fields.find(tag);
+			venue += (it != entry->fields.end() ? trim(unquote(it->second)) : string()) + '\x00';
+		}
+
+		auto& group = groups[venue];
+		if (group.empty())
+			order.push_back(venue);
+		group.push_back(entry);
+	}
+
+	// parents are appended, as BibTeX expects them after the children
+	int factoredCount = 0, parentCount = 0;
+	for (auto& venue : order)
+	{
+		auto& group = groups[venue];
+		if (group.size() < 2) continue;
+
+		BibEntry* first = group[0];
+		string base = VenueKey(first->getExpandedField("booktitle"), first->getYear());
+		string key = base;
+		for (int k = 0; keyEntryMap.count(to_lower(key)); k++)
+			key = base + KeySuffix(k);
+
+		BibEntry* parent = new BibEntry("proceedings", key);
+		parent->macros = macros.get();
+		parent->fields["title"] = first->fields["booktitle"];
+		for (auto& tag : VENUE_FIELDS)
+			if (first->fields.count(tag))
+				parent->fields[tag] = first->fields[tag];
+
+		// the delimiters follow the booktitle, which may be an abbreviation without any
+		string openQ, closeQ;
+		unquote(first->fields["booktitle"], openQ, closeQ);
+		if (openQ == "")
+			openQ = "{", closeQ = "}";
+		for (auto entry : group)
+		{
+			for (auto& tag : VENUE_FIELDS)
+				if (tag != "year")
+					entry->fields.erase(tag);
+			entry->fields["crossref"] = openQ + key + closeQ;
+			entry->refEntry = parent;
+		}
 
-			if (entry->key != nvalue)
+		entries.push_back(parent);
+		keyEntryMap[to_lower(key)] = parent;
+		factoredCount += (int)group.size();
+		parentCount++;
+	}
+
+	BuildCrossrefGraph();
+	Logger::Debug("factored " + to_string(factoredCount) + " entries into " + to_string(parentCount) + " proceedings");
+}
+
+// lower-case initials of the significant words, acronyms kept whole, e.g. jacm for Journal of the ACM
+static string MacroName(const string& text)
+{
+	string res;
+	for (auto& word : split(text, " \t\r\n~-/"))
+	{
+		string letters;
+		bool upper = true;
+		for (auto ch : word)
+			if (isalpha((unsigned char)ch))
 			{
-				Logger::Debug("modified key in " + entry->key + " to '" + nvalue + "'");
-				entry->key = nvalue;
+				letters += ch;
+				upper &= (isupper((unsigned char)ch) != 0);
 			}
+
+		if (letters == "" || isStopWord(letters)) continue;
+		res += to_lower(upper && letters.length() > 1 ? letters : letters.substr(0, 1));
+		if (res.length() >= 12) break;
+	}
+	return (res == "" ? "str" : res.substr(0, 12));
+}
+
+void BibDatabase::FactorStrings(int minCount)
+{
+	// fields holding the names of venues and institutions, as in the usual abbreviation files
+	static const set<string> STRING_FIELDS = {"journal", "booktitle", "publisher", "series", "address", "organization", "institution", "school", "howpublished"};
+
+	// a single hashing pass assigns ids to the delimited values and records every occurrence
+	unordered_map<string, int> valueIds;
+	vector<string> values, delimited;
+	vector<int> counts;
+	vector<pair<string*, int> > occurrences;
+	// bare names in the values, which may refer to abbreviations defined in other files
+	unordered_set<string> usedNames;
+	for (auto entry : entries)
+		for (auto& field : entry->fields)
+		{
+			const string& value = field.second;
+			if (value.empty() || (value[0] != '{' && value[0] != '"') || value.find('#') != string::npos)
+				for (auto& part : BibMacroTable::SplitConcatenation(value))
+					if (!part.empty() && part[0] != '{' && part[0] != '"' && !isInteger(part))
+						usedNames.insert(to_lower(part));
+
+			if (!STRING_FIELDS.count(field.first) || value.length() < 2 || (value[0] != '{' && value[0] != '"')) continue;
+			if (value.find('#') != string::npos && BibMacroTable::SplitConcatenation(value).size() > 1) continue;
+
+			string text = unquote(value);
+			auto it = valueIds.find(text);
+			if (it == valueIds.end())
+			{
+				it = valueIds.insert(make_pair(text, (int)values.size())).first;
+				values.push_back(text);
+				delimited.push_back(value);
+				counts.push_back(0);
+			}
+			counts[it->second]++;
+			occurrences.push_back(make_pair(&field.second, it->second));
 		}
+
+	// existing abbreviations with the same text are reused
+	unordered_map<string, string> existing;
+	for (auto a : abbrv)
+	{
+		auto parts = BibMacroTable::SplitConcatenation(a->value);
+		if (parts.size() == 1 && !parts[0].empty() && (parts[0][0] == '{' || parts[0][0] == '"'))
+			existing.insert(make_pair(unquote(parts[0]), a->tag));
 	}
 
-	if (texFile != "")
-		ConvertTexKeys(texFile);
+	// names are assigned in the order of the first occurrence
+	vector<string> names(values.size());
+	int definedCount = 0, replacedCount = 0;
+	for (int i = 0; i < (int)values.size(); i++)
+	{
+		if (counts[i] < minCount || isInteger(values[i])) continue;
 
-	InitKeyEntryMap();
+		auto it = existing.find(values[i]);
+		if (it != existing.end())
+		{
+			names[i] = it->second;
+			continue;
+		}
+
+		string base = MacroName(values[i]);
+		if (values[i].length() <= base.length()) continue;
+
+		string name = base;
+		for (int k = 0; macros->IsDefined(name) || usedNames.count(to_lower(name)); k++)
+			name = base + KeySuffix(k);
+
+		BibAbbrv* a = new BibAbbrv(name, delimited[i]);
+		abbrv.push_back(a);
+		macros->Define(name, delimited[i]);
+		names[i] = name;
+		definedCount++;
+	}
+
+	for (auto& occurrence : occurrences)
+		if (names[occurrence.second] != "")
+		{
+			*occurrence.first = names[occurrence.second];
+			replacedCount++;
+		}
+
+	Logger::Debug("replaced " + to_string(replacedCount) + " values with " + to_string(definedCount) + " new string abbreviations");
 }
 
-string BibDatabase::GenerateKey(const string& option, const BibEntry* entry, const vector<Author>& authors) const
+void BibDatabase::FindDuplicates(bool collapse, const vector<string>& texFiles)
 {
-	if (option == "alpha")
+	// content keys and their hashes are computed in parallel
+	int n = (int)entries.size();
+	vector<string> contentKeys(n);
+	vector<unsigned long long> hashes(n);
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int i = 0; i < n; i++)
+	{
+		entries[i]->InitCollationKeys();
+		if (entries[i]->getTitleKey() == "") continue;
+
+		contentKeys[i] = entries[i]->getContentKey();
+		hashes[i] = hash64(contentKeys[i]);
+	}
+
+	// grouping by hash; entries with colliding hashes are compared by content
+	unordered_map<unsigned long long, vector<int> > groups;
+	groups.reserve(n);
+	vector<vector<int> > duplicates(n);
+	for (int i = 0; i < n; i++)
+	{
+		if (contentKeys[i] == "") continue;
+
+		vector<int>& group = groups[hashes[i]];
+		bool found = false;
+		for (int j : group)
+			if (contentKeys[j] == contentKeys[i])
+			{
+				duplicates[j].push_back(i);
+				found = true;
+				break;
+			}
+
+		if (!found)
+			group.push_back(i);
+	}
+
+	unordered_map<BibEntry*, BibEntry*> replaced;
+	int groupCount = 0;
+	for (int i = 0; i < n; i++)
 	{
-		string year = entry->getYear();
-		if ((int)year.length() == 4) year = year.substr(2, 2);
-		string author;
+		if (duplicates[i].empty()) continue;
+		groupCount++;
+
+		BibEntry* entry = entries[i];
+		string keys;
+		for (int j : duplicates[i])
+			keys += ", " + entries[j]->key;
+		Logger::Warning("identical entries " + entry->key + keys);
+
+		if (!collapse) continue;
 
-		if (authors.empty()) 
+		// the first entry is kept and gets the fields missing in it
+		for (int j : duplicates[i])
 		{
-			author = "";
+			BibEntry* dup = entries[j];
+			for (auto& f : dup->fields)
+				if (!entry->fields.count(f.first))
+					entry->fields[f.first] = f.second;
+
+			replaced[dup] = entry;
+			keyEntryMap[to_lower(dup->key)] = entry;
+			Logger::Debug("collapsed " + dup->key + " into " + entry->key);
 		}
-		else if ((int)authors.size() == 1) 
+	}
+
+	Logger::Debug("found " + to_string(groupCount) + " groups of identical entries");
+	if (replaced.empty()) return;
+
+	// crossrefs to removed entries point to the kept ones
+	vector<BibEntry*> kept;
+	for (auto entry : entries)
+	{
+		if (replaced.count(entry))
+			continue;
+
+		if (entry->refEntry != nullptr && replaced.count(entry->refEntry))
 		{
-			size_t i = 0;
-			string s = "";
-			while (i < authors[0].last.length() && s.length() < 3)
+			entry->refEntry = replaced[entry->refEntry];
+			string openQ, closeQ;
+			unquote(entry->fields["crossref"], openQ, closeQ);
+			entry->fields["crossref"] = openQ + entry->refEntry->key + closeQ;
+		}
+		kept.push_back(entry);
+	}
+
+	for (auto& r : replaced)
+		delete r.first;
+	entries.swap(kept);
+
+	// inheritance tables may refer to the removed entries
+	BuildCrossrefGraph();
+
+	// the keys of the removed entries map to the kept ones
+	if (!texFiles.empty())
+		ConvertTexKeys(texFiles);
+}
+
+void BibDatabase::ConvertKeys(const BibKeyTemplate& keyTemplate, BibKeyRegistry* registry, const vector<string>& texFiles)
+{
+	// keys are generated in parallel; entries without a generated key keep the former one
+	int n = (int)entries.size();
+	vector<string> newKeys(n);
+	vector<string> fingerprints(n);
+	#pragma omp parallel for schedule(dynamic, 256)
+	for (int i = 0; i < n; i++)
+	{
+		newKeys[i] = keyTemplate.Key(entries[i]);
+		if (newKeys[i] == "")
+			newKeys[i] = entries[i]->key;
+		if (registry != nullptr)
+			fingerprints[i] = BibKeyRegistry::Fingerprint(entries[i]);
+	}
+
+	if (registry != nullptr)
+	{
+		// identical entries share a fingerprint; the later ones are told apart by their occurrence
+		unordered_map<string, int> occurrences;
+		for (auto& fingerprint : fingerprints)
+			if (fingerprint != "")
 			{
-				if (isalpha(authors[0].last[i]))
-					s += authors[0].last[i];
-				i++;
+				int k = occurrences[fingerprint]++;
+				if (k > 0) fingerprint += "-" + to_string(k);
 			}
-			author = s;
-		}
-		else
+
+		AssignRegisteredKeys(*registry, newKeys, fingerprints);
+	}
+	else
+	{
+		// colliding keys get suffixes in the order of entries
+		unordered_map<string, int> groupSize;
+		groupSize.reserve(n);
+		vector<int> position(n);
+		for (int i = 0; i < n; i++)
+			position[i] = groupSize[newKeys[i]]++;
+
+		for (int i = 0; i < n; i++)
+			if (groupSize[newKeys[i]] > 1) 
+				newKeys[i] += KeySuffix(position[i]);
+	}
+
+	for (int i = 0; i < n; i++)
+	{
+		BibEntry* entry = entries[i];
+		if (entry->key != newKeys[i])
 		{
-			for (int i = 0; i < (int)authors.size() && i < 5; i++)
-				if (authors[i].last != "others")	
-				{
-					size_t j = 0;
-					while (j < authors[i].last.length() && !isalpha(authors[i].last[j]))
-						j++;
-					if (j < authors[i].last.length())
-						author += authors[i].last[j];
-				}
-			if ((int)authors.size() > 6) author += "+";
-			else if ((int)authors.size() == 6) author += authors[5].last[0];
+			Logger::Debug("modified key in " + entry->key + " to '" + newKeys[i] + "'");
+			entry->key = newKeys[i];
 		}
+	}
 
-		return author + year;
+	if (!texFiles.empty())
+		ConvertTexKeys(texFiles);
+
+	InitKeyEntryMap();
+}
+
+void BibDatabase::AssignRegisteredKeys(BibKeyRegistry& registry, vector<string>& newKeys, const vector<string>& fingerprints) const
+{
+	// registered entries keep their keys
+	int n = (int)entries.size();
+	unordered_set<string> taken;
+	taken.reserve(n);
+	vector<bool> registered(n, false);
+	for (int i = 0; i < n; i++)
+	{
+		if (fingerprints[i] == "") continue;
+
+		string key = registry.Lookup(fingerprints[i]);
+		if (key != "" && taken.insert(to_lower(key)).second)
+		{
+			newKeys[i] = key;
+			registered[i] = true;
+		}
 	}
-	else if (option == "abstract")
+
+	// other entries get the first free suffix and are registered
+	int registeredCount = 0;
+	for (int i = 0; i < n; i++)
 	{
-		string year = entry->getYear();
-		string first_author = (authors.empty() ? "" : split(authors[0].last, " ")[0]);
+		if (registered[i]) continue;
+
+		string base = newKeys[i];
+		for (int k = 0; !taken.insert(to_lower(newKeys[i])).second; k++)
+			newKeys[i] = base + KeySuffix(k);
 
-		if (year != "")
-			return first_author + "-" + year;
-		return first_author;
+		if (fingerprints[i] != "")
+		{
+			registry.Assign(fingerprints[i], newKeys[i]);
+			registeredCount++;
+		}
 	}
 
-	return "";
+	Logger::Debug("registered " + to_string(registeredCount) + " new keys");
 }
 
-void BibDatabase::ConvertTexKeys(const string& texFile)
+void BibDatabase::RenameKeys(const string& mapFile, const vector<string>& texFiles)
 {
-	// reading
-	ifstream is;
-	is.open(texFile.c_str(), ios::in);
-	Logger::Error(is != 0, "can't open tex file '" + texFile + "'");
-	string s((istreambuf_iterator<char>(is)), istreambuf_iterator<char>());
-	is.close();
-
-	// replacing
-	int replacedCount = 0, keptCount = 0;
-	regex re("\\\\cite(\\s*)\\{([^\\{\\}])*\\}");
-    string result;
-    auto callback = [&](const string& m) 
-	{
-		if (!regex_match(m, re))
+	// reading the mapping of old keys to new ones, one pair per line
+	ifstream is(mapFile.c_str(), ios::in);
+	Logger::Error(is.good(), "can't open key mapping file '" + mapFile + "'");
+
+	unordered_map<string, string> renamed;
+	string line;
+	int lineNumber = 0;
+	while (getline(is, line))
+	{
+		lineNumber++;
+		line = trim(line);
+		if (line == "" || line[0] == '#') continue;
+
+		size_t sep = line.find_first_of(" \t");
+		Logger::Error(sep != string::npos, "invalid line " + to_string(lineNumber) + " in key mapping file '" + mapFile + "'");
+		string oldKey = to_lower(line.substr(0, sep));
+		string newKey = trim(line.substr(sep + 1));
+
+		auto it = renamed.find(oldKey);
+		if (it != renamed.end() && it->second != newKey)
+			Logger::Warning("conflicting new keys '" + it->second + "' and '" + newKey + "' for " + line.substr(0, sep) + " in " + mapFile);
+		renamed[oldKey] = newKey;
+	}
+	Logger::Debug("read " + to_string(renamed.size()) + " key renamings from " + mapFile);
+
+	// a renaming onto a key that stays in use is skipped before any key is changed;
+	// a skipped renaming keeps its old key, which may block another one
+	bool skipped = true;
+	while (skipped)
+	{
+		skipped = false;
+		unordered_map<string, int> keyCounts;
+		for (auto entry : entries)
+		{
+			auto it = renamed.find(to_lower(entry->key));
+			keyCounts[to_lower(it != renamed.end() ? it->second : entry->key)]++;
+		}
+
+		for (auto entry : entries)
+		{
+			auto it = renamed.find(to_lower(entry->key));
+			if (it == renamed.end() || keyCounts[to_lower(it->second)] == 1) continue;
+
+			Logger::Warning("new key '" + it->second + "' for " + entry->key + " is already in use; the key is not renamed");
+			renamed.erase(it);
+			skipped = true;
+		}
+	}
+
+	// keys and crossrefs
+	int renamedCount = 0;
+	for (auto entry : entries)
+	{
+		auto it = renamed.find(to_lower(entry->key));
+		if (it != renamed.end() && it->second != entry->key)
 		{
-			result += m;
-			return;
+			Logger::Debug("modified key in " + entry->key + " to '" + it->second + "'");
+			entry->key = it->second;
+			renamedCount++;
 		}
 
-		result += "\\cite{";
+		if (!entry->fields.count("crossref")) continue;
+
+		string openQ, closeQ;
+		string ref = unquote(entry->fields["crossref"], openQ, closeQ);
+		it = renamed.find(to_lower(ref));
+		if (it != renamed.end())
+			entry->fields["crossref"] = openQ + it->second + closeQ;
+	}
+	Logger::Debug("renamed " + to_string(renamedCount) + " keys");
+
+	// citations are looked up by the former keys; old keys of other bibliographies
+	// refer to the entries having the new keys
+	unordered_map<string, BibEntry*> newKeys;
+	for (auto entry : entries)
+		newKeys[to_lower(entry->key)] = entry;
+	for (auto& r : renamed)
+	{
+		auto it = newKeys.find(to_lower(r.second));
+		if (!keyEntryMap.count(r.first) && it != newKeys.end())
+			keyEntryMap[r.first] = it->second;
+	}
+
+	if (!texFiles.empty())
+		ConvertTexKeys(texFiles);
+
+	InitKeyEntryMap();
+}
 
-		int firstBracket = m.find_first_of('{');
-		int lastBracket = m.find_last_of('}');
-		string refString = m.substr(firstBracket + 1, lastBracket - firstBracket - 1);
-		vector<string> refs = split(refString, ",");
-		for (int i = 0; i < (int)refs.size(); i++)
+string BibDatabase::RewriteTexKeys(const string& s, int& replacedCount, int& keptCount, vector<string>& missing) const
+{
+	// the text between the rewritten keys is copied as is
+	string result;
+	result.reserve(s.length());
+	size_t copied = 0;
+	for (auto& list : tex_citations::findKeyLists(s))
+		for (auto& ref : tex_citations::splitKeys(s, list.first, list.second))
 		{
-			if (i != 0) result += ",";
+			string key = s.substr(ref.first, ref.second - ref.first);
+			if (key == "*") continue;
 
-			string t = to_lower(trim(refs[i]));
-			if (keyEntryMap.count(t))
+			auto it = keyEntryMap.find(to_lower(key));
+			if (it == keyEntryMap.end())
 			{
-				result += keyEntryMap[t]->key;
-				if (trim(refs[i]) != keyEntryMap[t]->key)
-					replacedCount++;
-				else
-					keptCount++;
+				missing.push_back(key);
+				continue;
 			}
-			else
+
+			if (key == it->second->key)
 			{
-				result += refs[i];
-				Logger::Warning("citation " + refs[i] + " from " + texFile + " not found in the database ");
+				keptCount++;
+				continue;
 			}
+
+			result.append(s, copied, ref.first - copied);
+			result += it->second->key;
+			copied = ref.second;
+			replacedCount++;
 		}
+	result.append(s, copied, string::npos);
+
+	return result;
+}
 
-		result += "}";
-    };
+void BibDatabase::ConvertTexKeys(const vector<string>& texFiles) const
+{
+	// files are rewritten in parallel with the shared read-only key map
+	int n = (int)texFiles.size();
+	vector<int> replacedCount(n, 0), keptCount(n, 0);
+	vector<vector<string> > missing(n);
+	vector<char> failed(n, 0);
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (int i = 0; i < n; i++)
+	{
+		// reading; errors are reported outside of the parallel loop
+		ifstream is(texFiles[i].c_str(), ios::in | ios::binary);
+		if (!is.good())
+		{
+			failed[i] = 1;
+			continue;
+		}
+		ostringstream buffer;
+		buffer << is.rdbuf();
+		is.close();
 
-    sregex_token_iterator begin(s.begin(), s.end(), re, vector_of_ints(-1)(0)()), end;
-    for_each(begin, end, callback);
-	s = result;
-	Logger::Debug("replaced " + to_string(replacedCount) + ", unchanged " + to_string(keptCount) + " citation keys in " + texFile);
+		string result = RewriteTexKeys(buffer.str(), replacedCount[i], keptCount[i], missing[i]);
 
-	// output
-	ofstream os;
-	os.open((texFile + ".new").c_str(), ios::out);
-	os << s;
-	os.close();
-}
+		// files without changed citations are not touched
+		if (replacedCount[i] == 0) continue;
 
+		// output
+		ofstream os;
+		os.open((texFiles[i] + ".new").c_str(), ios::out | ios::binary);
+		os << result;
+		os.close();
+	}
 
-void BibDatabase::FormatAuthor(const string& option) const
+	// the index for suggestions is built only when there are missing keys
+	unique_ptr<BibKeyIndex> index;
+	int changedCount = 0;
+	for (int i = 0; i < n; i++)
+	{
+		Logger::Error(!failed[i], "can't open tex file '" + texFiles[i] + "'");
+		for (auto& key : missing[i])
+		{
+			if (index == nullptr)
+				index = BibKeyIndex::Create(keyEntryMap);
+			Logger::Warning("citation " + key + " from " + texFiles[i] + " not found in the database" + Suggestions(*index, key));
+		}
+
+		string summary = "replaced " + to_string(replacedCount[i]) + ", unchanged " + to_string(keptCount[i]) + " citation keys in " + texFiles[i];
+		if (replacedCount[i] > 0)
+		{
+			Logger::Info(summary);
+			changedCount++;
+		}
+		else
+			Logger::Debug(summary);
+	}
+
+	if (n > 1)
+		Logger::Info("modified " + to_string(changedCount) + " of " + to_string(n) + " tex files");
+}
+
+void BibDatabase::FormatAuthor(BibEntry* entry, const string& option) const
 {
 	assert(option == "space" || option == "comma");
 
-	for (auto entry: entries)
-	{
-		if (!entry->fields.count("author")) continue;
-		string openQ, closeQ;
-		string value = unquote(entry->fields["author"], openQ, closeQ);
-		vector<Author> authors = entry->getAuthors();
+	if (!entry->fields.count("author")) return;
+	string openQ, closeQ;
+	string value = unquote(entry->fields["author"], openQ, closeQ);
+	vector<Author> authors = entry->getAuthors();
 
-		string nvalue = "";
-		for (Author a : authors)
-			if (a.first != "" || a.von != "" || a.last != "")
+	string nvalue = "";
+	for (Author a : authors)
+		if (a.first != "" || a.von != "" || a.last != "")
+		{
+			if (nvalue != "") nvalue += " and ";
+			if (option == "space") 
 			{
-				if (nvalue != "") nvalue += " and ";
-				if (option == "space") 
-				{
-					nvalue += a.first + " " + a.von + " " + a.last;
-				}
-				else
-				{
-					nvalue += a.von + " " + a.last;
-					if (a.first != "") nvalue += ", " + a.first;
-				}
+				nvalue += a.first + " " + a.von + " " + a.last;
+			}
+			else
+			{
+				nvalue += a.von + " " + a.last;
+				if (a.first != "") nvalue += ", " + a.first;
 			}
-
-		nvalue = replace(trim(nvalue), "  ", " ");
-		if (value != nvalue)
-		{
-			Logger::Debug("modified format of author in " + entry->key + " to '" + nvalue + "'");
-			entry->fields["author"] = openQ + nvalue + closeQ;;
 		}
+
+	nvalue = replace(trim(nvalue), "  ", " ");
+	if (value != nvalue)
+	{
+		Logger::Debug("modified format of author in " + entry->key + " to '" + nvalue + "'");
+		entry->fields["author"] = openQ + nvalue + closeQ;;
 	}
 }
 
-void BibDatabase::SortEntries(const string& option)
+vector<string> BibDatabase::SortEntries(const BibSortSpec& spec)
 {
-	assert(option == "author" || option == "title" || option == "year-asc" || option == "year-desc");
-
-	if (option == "author")
-		stable_sort(entries.begin(), entries.end(), BibEntry::AuthorComparator);
-	else if (option == "title")
-		stable_sort(entries.begin(), entries.end(), BibEntry::TitleComparator);
-	else if (option == "year-asc")
-		stable_sort(entries.begin(), entries.end(), BibEntry::YearAscComparator);
-	else if (option == "year-desc")
-		stable_sort(entries.begin(), entries.end(), BibEntry::YearDescComparator);
+	// decorate: a byte-comparable key is computed once per entry (fields may have been modified)
+	int n = (int)entries.size();
+	vector<string> keys(n);
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int i = 0; i < n; i++)
+	{
+		entries[i]->InitCollationKeys();
+		keys[i] = spec.Key(entries[i]);
+	}
+
+	// crossref targets have to follow the entries referring to them; children precede
+	// their parents in the reversed topological order, so the keys propagate up the chains
+	vector<BibEntry*> graph = BuildCrossrefGraph();
+	unordered_map<const BibEntry*, int> index;
+	index.reserve(n);
+	for (int i = 0; i < n; i++)
+		index[entries[i]] = i;
+	for (auto it = graph.rbegin(); it != graph.rend(); ++it)
+	{
+		const BibEntry* parent = (*it)->refEntry;
+		if (parent == nullptr || !index.count(parent)) continue;
+
+		string& childKey = keys[index[*it]];
+		string& parentKey = keys[index[parent]];
+		if (parentKey <= childKey)
+			parentKey = childKey + '\xff';
+	}
+
+	// sort: a radix sort for fixed-width keys, a parallel merge sort otherwise
+	vector<int> order = BibSortSpec::SortOrder(keys);
+
+	// undecorate
+	vector<BibEntry*> sorted(n);
+	vector<string> sortedKeys(n);
+	for (int i = 0; i < n; i++)
+	{
+		sorted[i] = entries[order[i]];
+		sortedKeys[i].swap(keys[order[i]]);
+	}
+	entries.swap(sorted);
+
+	return sortedKeys;
 }
 
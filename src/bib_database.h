@@ -2,21 +2,31 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_set>
 
 #include "bib_entry.h"
+#include "bib_key_registry.h"
+#include "bib_key_template.h"
+#include "bib_lint.h"
+#include "bib_macro_table.h"
+#include "bib_sort.h"
 
 using namespace std;
 
 class BibDatabase
 {
 	friend class BibParser;
+	friend class BibPassManager;
+	friend class BibExternalSort;
+	friend class BibMerge;
 
 	vector<BibEntry*> entries;
 	vector<BibAbbrv*> abbrv;
 	vector<BibComment*> comments;
 	vector<BibPreamble*> preambles;
+	unique_ptr<BibMacroTable> macros;
 
-	int inputFilesize;
+	long long inputFilesize;
 	string inputFilename;
 
 	map<string, BibEntry*> keyEntryMap;
@@ -24,10 +34,11 @@ class BibDatabase
 private:
 	BibDatabase(const BibDatabase&);
 	BibDatabase& operator = (const BibDatabase&);
-	BibDatabase() {};
+	BibDatabase(): macros(BibMacroTable::Create()) {};
 
-	string GenerateKey(const string& option, const BibEntry* entry, const vector<Author>& authors) const;
 	void FixPadding(BibEntry* entry, const string& tag) const;
+	string RewriteTexKeys(const string& s, int& replacedCount, int& keptCount, vector<string>& missing) const;
+	void AssignRegisteredKeys(BibKeyRegistry& registry, vector<string>& newKeys, const vector<string>& fingerprints) const;
 
 public:
 	static unique_ptr<BibDatabase> Create()
@@ -40,17 +51,34 @@ public:
 	void LogDetails() const;
 
 	void InitKeyEntryMap();
-	void InitRefEntries() const;
-	void CheckRequiredFields() const;
-
-	void ConvertFieldDelimeters(const string& option) const;
-	void ReplaceUnicodeCharacters() const;
-	void FixPagesDash() const;
-	void FixPadding() const;
-	void ConvertKeys(const string& option, const string& texFile);
-	void ConvertTexKeys(const string& texFile);
-	void SortEntries(const string& option);
-	void FormatAuthor(const string& option) const;
+	// partial: the database is a run of a larger input, which may hold the missing targets
+	void InitRefEntries(bool partial) const;
+	vector<BibEntry*> BuildCrossrefGraph() const;
+
+	// per-entry transformations
+	void ConvertFieldDelimeters(BibEntry* entry, const string& option) const;
+	void ReplaceUnicodeCharacters(BibEntry* entry) const;
+	void ReplaceLatexCommands(BibEntry* entry) const;
+	void FixPagesDash(BibEntry* entry) const;
+	void FixPadding(BibEntry* entry) const;
+	void FormatAuthor(BibEntry* entry, const string& option) const;
+
+	// global transformations
+	void Lint(const BibLinter& linter, const string& reportFile) const;
+	void ReplaceUnicodeInAbbreviations();
+	void ReplaceLatexInAbbreviations();
+	void FilterCited(unordered_set<string>& cited, bool reportMissing);
+	void FindDuplicates(bool collapse, const vector<string>& texFiles);
+	void FlattenCrossrefs();
+	void FactorCrossrefs();
+	void FactorStrings(int minCount);
+	void FindNearDuplicates(double threshold) const;
+	void ConvertKeys(const BibKeyTemplate& keyTemplate, BibKeyRegistry* registry, const vector<string>& texFiles);
+	void ConvertTexKeys(const vector<string>& texFiles) const;
+	void RenameKeys(const string& mapFile, const vector<string>& texFiles);
+	vector<string> SortEntries(const BibSortSpec& spec);
+	void ClearEntries();
+	void MoveItems(BibDatabase& other);
 	void SyncDBLP(const string& dbFile) const;
 };
 
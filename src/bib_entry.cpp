@@ -1,6 +1,8 @@
 #include "bib_entry.h"
 #include "string_utilities.h"
 #include "logger.h"
+#include "unicode_latex.h"
+#include "bib_macro_table.h"
 
 #include <algorithm>
 #include <cassert>
@@ -72,73 +74,61 @@ bool BibEntry::TagComparator(const string& s1, const string& s2)
 	return false;
 }
 
-bool BibEntry::AuthorComparator(const BibEntry* e1, const BibEntry* e2)
+string BibEntry::getType() const
 {
-	vector<Author> authors1 = e1->getAuthors();
-	vector<Author> authors2 = e2->getAuthors();
-	int n1 = (int)authors1.size(), n2 = (int)authors2.size();
-
-	if (n1 == 0 || n2 == 0)
-	{
-		if (n1 == 0 && n2 == 0) return false;
-		if (n1 == 0) return false;
-		return true;
-	}
-
-	for (int i = 0; i < n1 && i < n2; i++)
-	{
-		if (authors1[i].last < authors2[i].last) return true;
-		if (authors1[i].last > authors2[i].last) return false;
-	}
+	return type;
+}
 
-	if (n1 < n2) return true;
-	if (n1 > n2) return false;
+string BibEntry::getKey() const
+{
+	return key;
+}
 
-	return false;
+bool BibEntry::hasField(const string& tag) const
+{
+	return fields.count(tag) > 0;
 }
 
-bool BibEntry::TitleComparator(const BibEntry* e1, const BibEntry* e2)
+string BibEntry::getField(const string& tag) const
 {
-	string title1 = e1->getTitle();
-	string title2 = e2->getTitle();
-	if (title1 == title2)
-		return YearAscComparator(e1, e2);
+	if (fields.count(tag))
+		return fields.find(tag)->second;
 
-	return (title1 < title2);
+	return "";
 }
 
-bool BibEntry::YearAscComparator(const BibEntry* e1, const BibEntry* e2)
+void BibEntry::setField(const string& tag, const string& value)
 {
-	string year1 = e1->getYear();
-	string year2 = e2->getYear();
+	fields[tag] = value;
+	if (tag == "author")
+		authors.clear();
+	collationReady = false;
+}
 
-	if (year1 == year2) 
-		return AuthorComparator(e1, e2);
+string BibEntry::getInheritedField(const string& tag) const
+{
+	auto it = fields.find(tag);
+	if (it != fields.end())
+		return it->second;
 
-	if (year1 == "" || year2 == "")
-	{
-		if (year1 == "") return false;
-		if (year2 == "") return true;
-	}
+	auto ref = inherited.find(tag);
+	if (ref != inherited.end())
+		return ref->second->fields.find(tag)->second;
 
-	return (year1 < year2);
+	return "";
 }
 
-bool BibEntry::YearDescComparator(const BibEntry* e1, const BibEntry* e2)
+string BibEntry::getExpandedField(const string& tag) const
 {
-	string year1 = e1->getYear();
-	string year2 = e2->getYear();
-
-	if (year1 == year2) 
-		return AuthorComparator(e1, e2);
+	return Expand(getInheritedField(tag));
+}
 
-	if (year1 == "" || year2 == "")
-	{
-		if (year1 == "") return false;
-		if (year2 == "") return true;
-	}
+string BibEntry::Expand(const string& value) const
+{
+	if (macros == nullptr)
+		return unquote(value);
 
-	return (year2 < year1);
+	return macros->Expand(value);
 }
 
 set<string> BibEntry::getFields() const
@@ -147,30 +137,21 @@ set<string> BibEntry::getFields() const
 	for (auto f : fields)
 		res.insert(f.first);
 
-	if (refEntry != nullptr)
-	{
-		for (auto f : refEntry->fields)
-			res.insert(f.first);
-	}
+	for (auto f : inherited)
+		res.insert(f.first);
 
 	return res;
 }
 
 string BibEntry::getYear() const
 {
-	if (fields.count("year")) 
-		return unquote(fields.find("year")->second);
-
-	if (refEntry != nullptr && refEntry->fields.count("year"))
-		return unquote(refEntry->fields.find("year")->second);
-
-	return "";
+	return getExpandedField("year");
 }
 
 string BibEntry::getTitle() const
 {
 	if (fields.count("title")) 
-		return unquote(fields.find("title")->second);
+		return Expand(fields.find("title")->second);
 
 	return "";
 }
@@ -188,11 +169,64 @@ vector<Author> BibEntry::getAuthors() const
 	return authors;
 }
 
+void BibEntry::InitCollationKeys() const
+{
+	authorKey.clear();
+	for (auto& a : getAuthors())
+		authorKey += unicode_latex::collationKey(a.last) + '\x01';
+
+	titleKey = unicode_latex::collationKey(getTitle());
+	collationReady = true;
+}
+
+string BibEntry::getContentKey() const
+{
+	// type, title, authors and year, ignoring delimiters, markup, case and whitespace
+	string res = type;
+	res += '\x00';
+	res += getTitleKey();
+	res += '\x00';
+	res += getAuthorKey();
+	res += '\x00';
+	res += trim(getYear());
+	return res;
+}
+
+const string& BibEntry::getAuthorKey() const
+{
+	if (!collationReady)
+		InitCollationKeys();
+	return authorKey;
+}
+
+const string& BibEntry::getTitleKey() const
+{
+	if (!collationReady)
+		InitCollationKeys();
+	return titleKey;
+}
+
+size_t BibEntry::getMemorySize() const
+{
+	// every map node carries the tree links and two strings; heap blocks of strings are
+	// rounded up to 16 bytes and carry an 8-byte header
+	const size_t NODE_SIZE = 32 + 2 * sizeof(string) + 16;
+	auto heapSize = [](const string& s) { return s.capacity() < 16 ? 0 : (s.capacity() + 1 + 8 + 15) / 16 * 16; };
+
+	size_t res = sizeof(BibEntry) + 16 + heapSize(type) + heapSize(key);
+	for (auto& f : fields)
+		res += NODE_SIZE + heapSize(f.first) + heapSize(f.second);
+	for (auto& a : authors)
+		res += sizeof(Author) + heapSize(a.first) + heapSize(a.last) + heapSize(a.von);
+	res += heapSize(authorKey) + heapSize(titleKey);
+	return res;
+}
+
 vector<Author> BibEntry::ParseAuthors() const
 {
 	vector<Author> result;
 
-	string s = unquote(fields.find("author")->second);
+	string s = Expand(fields.find("author")->second);
 	s = replace(s, "\n", " ");
 	s = replace(s, "\t", " ");
 	s = replace(s, "\r", " ");
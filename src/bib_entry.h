@@ -7,6 +7,8 @@
 
 using namespace std;
 
+class BibMacroTable;
+
 class Author
 {
 public:
@@ -20,30 +22,60 @@ class BibEntry
 	friend class BibParser;
 	friend class BibDatabase;
 	friend class DBLPDatabase;
+	friend class BibSortSpec;
+	friend class BibLinter;
+	friend class BibMerge;
 
 	string type;
 	string key;
 	map<string, string> fields;
 	BibEntry* refEntry;
+	// the nearest entry of the crossref chain defining every inherited field
+	map<string, const BibEntry*> inherited;
+	// @string abbreviations of the database the entry was read into
+	const BibMacroTable* macros;
 
 	mutable vector<Author> authors;
 
+	// collation keys (markup stripped, accents and case folded) for sorting and matching
+	mutable string authorKey;
+	mutable string titleKey;
+	mutable bool collationReady;
+
 private:
 	BibEntry(const BibEntry&);
 	BibEntry& operator = (const BibEntry&);
 
 	vector<Author> ParseAuthors() const;
 	Author ParseAuthor(const string& s) const;
+	string Expand(const string& value) const;
 
 public:
-	BibEntry(const string& type, const string& key): type(type), key(key), refEntry(nullptr) {}
+	BibEntry(const string& type, const string& key): type(type), key(key), refEntry(nullptr), macros(nullptr), collationReady(false) {}
 	~BibEntry() {}
 
+	string getType() const;
+	string getKey() const;
+	bool hasField(const string& tag) const;
+	string getField(const string& tag) const;
+	void setField(const string& tag, const string& value);
+	string getInheritedField(const string& tag) const;
+	// the value with abbreviations and concatenations resolved and delimiters removed
+	string getExpandedField(const string& tag) const;
+
 	set<string> getFields() const;
 	string getYear() const;
 	string getTitle() const;
 	vector<Author> getAuthors() const;
 
+	void InitCollationKeys() const;
+	string getContentKey() const;
+	const string& getAuthorKey() const;
+	const string& getTitleKey() const;
+
+	// an estimate of the memory held by the entry, including the allocator overhead
+	size_t getMemorySize() const;
+
 // static section
 private:
 	static const string TAG_ORDER[];
@@ -55,15 +87,12 @@ public:
 	static vector<string> GetRequiredFields(const string& type);
 
 	static bool TagComparator(const string& s1, const string& s2);
-	static bool AuthorComparator(const BibEntry* s1, const BibEntry* s2);
-	static bool TitleComparator(const BibEntry* s1, const BibEntry* s2);
-	static bool YearAscComparator(const BibEntry* s1, const BibEntry* s2);
-	static bool YearDescComparator(const BibEntry* s1, const BibEntry* s2);
 };
 
 class BibAbbrv
 {
 	friend class BibParser;
+	friend class BibDatabase;
 
 	string tag;
 	string value;
@@ -75,6 +104,9 @@ private:
 public:
 	BibAbbrv(const string& tag, const string& value): tag(tag), value(value) {}
 	~BibAbbrv() {}
+
+	string getTag() const { return tag; }
+	string getValue() const { return value; }
 };
 
 class BibComment
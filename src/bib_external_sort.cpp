@@ -0,0 +1,137 @@
+#include "bib_external_sort.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <sstream>
+#include <queue>
+#include <cstdint>
+
+using namespace string_utilities;
+
+BibExternalSort::~BibExternalSort()
+{
+	for (auto& run : runs)
+		fclose(run.file);
+}
+
+void BibExternalSort::WriteString(FILE* file, const string& s)
+{
+	uint32_t len = (uint32_t)s.length();
+	bool ok = (fwrite(&len, sizeof(len), 1, file) == 1);
+	ok &= (fwrite(s.data(), 1, s.length(), file) == s.length());
+	Logger::Error(ok, "can't write temporary run file");
+}
+
+bool BibExternalSort::ReadString(FILE* file, string& s)
+{
+	uint32_t len;
+	if (fread(&len, sizeof(len), 1, file) != 1) return false;
+
+	s.resize(len);
+	Logger::Error(len == 0 || fread(&s[0], 1, len, file) == len, "can't read temporary run file");
+	return true;
+}
+
+bool BibExternalSort::IsFull(const BibDatabase& chunk)
+{
+	for (; chunkCounted < chunk.entries.size(); chunkCounted++)
+		chunkSize += chunk.entries[chunkCounted]->getMemorySize();
+	return chunkSize >= memoryLimit;
+}
+
+void BibExternalSort::AddRun(BibDatabase& chunk)
+{
+	chunkSize = 0;
+	chunkCounted = 0;
+	if (chunk.entries.empty()) return;
+
+	// duplicates within the chunk are reported by InitKeyEntryMap
+	unordered_set<string> chunkKeys;
+	for (auto entry : chunk.entries)
+	{
+		string lkey = to_lower(entry->getKey());
+		if (chunkKeys.insert(lkey).second && keys.count(lkey))
+			Logger::Warning("duplicate key " + entry->getKey() + " in different runs");
+	}
+	keys.insert(chunkKeys.begin(), chunkKeys.end());
+
+	vector<string> sortKeys = chunk.SortEntries(spec);
+
+	Run run = {tmpfile(), 0};
+	Logger::Error(run.file != nullptr, "can't create temporary run file");
+	runs.push_back(run);
+
+	// a record is the sort key followed by the formatted entry
+	for (int i = 0; i < (int)chunk.entries.size(); i++)
+	{
+		ostringstream os;
+		parser.Write(os, chunk.entries[i]);
+
+		WriteString(run.file, sortKeys[i]);
+		WriteString(run.file, os.str());
+	}
+
+	Logger::Debug("spilled a sorted run of " + to_string(chunk.entries.size()) + " entries");
+	runCount++;
+	entryCount += chunk.entries.size();
+	chunk.ClearEntries();
+
+	// the levels do not increase along the runs, so a full group is at the end
+	while ((int)runs.size() >= MAX_FAN_IN && runs[runs.size() - MAX_FAN_IN].level == runs.back().level)
+		MergeLastRuns();
+}
+
+void BibExternalSort::MergeRuns(size_t first, size_t last, const function<void(const string& key, const string& text)>& write) const
+{
+	// the heap holds the current key of every run; ties go to the earlier run to keep the sort stable
+	typedef pair<string, size_t> HeapItem;
+	priority_queue<HeapItem, vector<HeapItem>, greater<HeapItem> > heap;
+	vector<string> texts(last - first);
+
+	for (size_t i = first; i < last; i++)
+	{
+		rewind(runs[i].file);
+		string key;
+		if (ReadString(runs[i].file, key) && ReadString(runs[i].file, texts[i - first]))
+			heap.push(make_pair(key, i));
+	}
+
+	while (!heap.empty())
+	{
+		HeapItem top = heap.top();
+		heap.pop();
+		size_t i = top.second;
+		write(top.first, texts[i - first]);
+
+		string key;
+		if (ReadString(runs[i].file, key) && ReadString(runs[i].file, texts[i - first]))
+			heap.push(make_pair(key, i));
+	}
+}
+
+void BibExternalSort::MergeLastRuns()
+{
+	size_t first = runs.size() - MAX_FAN_IN;
+	Run merged = {tmpfile(), runs.back().level + 1};
+	Logger::Error(merged.file != nullptr, "can't create temporary run file");
+
+	MergeRuns(first, runs.size(), [&](const string& key, const string& text)
+	{
+		WriteString(merged.file, key);
+		WriteString(merged.file, text);
+	});
+
+	for (size_t i = first; i < runs.size(); i++)
+		fclose(runs[i].file);
+	runs.resize(first);
+	runs.push_back(merged);
+	Logger::Debug("merged " + to_string(MAX_FAN_IN) + " runs into a run of level " + to_string(merged.level));
+}
+
+void BibExternalSort::Merge(ostream& os) const
+{
+	MergeRuns(0, runs.size(), [&](const string&, const string& text) { os << text; });
+
+	Logger::Info("sorted " + to_string(entryCount) + " entries in " + to_string(runCount) + " runs");
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_set>
+
+#include "bib_database.h"
+#include "bib_parser.h"
+#include "bib_sort.h"
+
+using namespace std;
+
+// Out-of-core sorting: sorted runs of serialized entries are spilled to
+// temporary files and k-way merged into the output. At most MAX_FAN_IN runs
+// are merged at once; full groups of runs are merged into intermediate runs
+// of the next level, so the number of open files grows logarithmically.
+class BibExternalSort
+{
+	struct Run
+	{
+		FILE* file;
+		int level;
+	};
+
+	static const int MAX_FAN_IN = 16;
+
+	const BibParser& parser;
+	const BibSortSpec& spec;
+
+	vector<Run> runs;
+	int runCount;
+	long long entryCount;
+	// the estimated memory of the entries of the current chunk, in bytes
+	long long memoryLimit;
+	long long chunkSize;
+	size_t chunkCounted;
+	// keys of the spilled entries, for duplicates across the runs
+	unordered_set<string> keys;
+
+private:
+	BibExternalSort(const BibExternalSort&);
+	BibExternalSort& operator = (const BibExternalSort&);
+	BibExternalSort(const BibParser& parser, const BibSortSpec& spec, long long memoryLimit):
+		parser(parser), spec(spec), runCount(0), entryCount(0), memoryLimit(memoryLimit), chunkSize(0), chunkCounted(0) {}
+
+	static void WriteString(FILE* file, const string& s);
+	static bool ReadString(FILE* file, string& s);
+
+	void MergeRuns(size_t first, size_t last, const function<void(const string& key, const string& text)>& write) const;
+	void MergeLastRuns();
+
+public:
+	static unique_ptr<BibExternalSort> Create(const BibParser& parser, const BibSortSpec& spec, long long memoryLimit)
+	{
+		return unique_ptr<BibExternalSort>(new BibExternalSort(parser, spec, memoryLimit));
+	}
+
+	~BibExternalSort();
+
+	// whether the entries parsed into the chunk reach the memory limit; parsed entries
+	// take several times the size of their text
+	bool IsFull(const BibDatabase& chunk);
+	void AddRun(BibDatabase& chunk);
+	void Merge(ostream& os) const;
+};
@@ -0,0 +1,133 @@
+#include "bib_key_index.h"
+
+#include "string_utilities.h"
+
+#include <algorithm>
+
+using namespace string_utilities;
+
+vector<unsigned int> BibKeyIndex::Trigrams(const string& key)
+{
+	// the key is padded, so that a key of length n has n + 2 trigrams
+	string s = "\x01\x01" + key + "\x02\x02";
+	vector<unsigned int> res;
+	for (int i = 0; i + 3 <= (int)s.length(); i++)
+		res.push_back(((unsigned char)s[i] << 16) | ((unsigned char)s[i + 1] << 8) | (unsigned char)s[i + 2]);
+
+	sort(res.begin(), res.end());
+	res.erase(unique(res.begin(), res.end()), res.end());
+	return res;
+}
+
+unsigned long long BibKeyIndex::PostingKey(unsigned int gram, size_t length)
+{
+	return ((unsigned long long)length << 24) | gram;
+}
+
+int BibKeyIndex::Distance(const string& s1, const string& s2, int bound)
+{
+	// Levenshtein distance with a single row; any value above the bound is returned as bound + 1
+	int n = (int)s1.length(), m = (int)s2.length();
+	if (abs(n - m) > bound) return bound + 1;
+
+	int buffer[64];
+	vector<int> heap;
+	int* row = buffer;
+	if (m + 1 > 64)
+	{
+		heap.resize(m + 1);
+		row = heap.data();
+	}
+
+	for (int j = 0; j <= m; j++)
+		row[j] = j;
+
+	for (int i = 1; i <= n; i++)
+	{
+		int diagonal = row[0];
+		row[0] = i;
+		int best = row[0];
+		for (int j = 1; j <= m; j++)
+		{
+			int up = row[j];
+			row[j] = min(min(up, row[j - 1]) + 1, diagonal + (s1[i - 1] != s2[j - 1] ? 1 : 0));
+			diagonal = up;
+			best = min(best, row[j]);
+		}
+		if (best > bound) return bound + 1;
+	}
+	return min(row[m], bound + 1);
+}
+
+void BibKeyIndex::Insert(const string& key, const BibEntry* entry)
+{
+	int id = (int)keys.size();
+	keys.push_back(key);
+	entries.push_back(entry);
+	for (auto gram : Trigrams(key))
+		postings[PostingKey(gram, key.length())].push_back(id);
+}
+
+vector<string> BibKeyIndex::Suggest(const string& key, int count) const
+{
+	vector<string> res;
+	string lkey = to_lower(key);
+	int radius = ((int)lkey.length() <= 4 ? 1 : 2);
+
+	// an edit changes at most three trigrams, so a similar key shares all but 3 * radius of them
+	auto grams = Trigrams(lkey);
+	int minShared = (int)grams.size() - 3 * radius;
+	if (minShared <= 0) return res;
+
+	if (shared.size() != keys.size())
+		shared.assign(keys.size(), 0);
+
+	vector<pair<int, int> > found;
+	int minLength = max(1, (int)lkey.length() - radius);
+	for (int length = minLength; length <= (int)lkey.length() + radius; length++)
+	{
+		vector<const vector<int>*> lists;
+		for (auto gram : grams)
+		{
+			auto it = postings.find(PostingKey(gram, length));
+			if (it != postings.end())
+				lists.push_back(&it->second);
+		}
+		if ((int)lists.size() < minShared) continue;
+
+		for (auto list : lists)
+			for (int id : *list)
+				shared[id]++;
+
+		// such a key is in one of any lists.size() - minShared + 1 lists; the shortest ones are scanned
+		sort(lists.begin(), lists.end(), [](const vector<int>* a, const vector<int>* b) { return a->size() < b->size(); });
+		for (int i = 0; i < (int)lists.size() - minShared + 1; i++)
+			for (int id : *lists[i])
+			{
+				if (shared[id] < minShared) continue;
+				shared[id] = 0;
+
+				int d = Distance(lkey, keys[id], radius);
+				if (d <= radius)
+					found.push_back(make_pair(d, id));
+			}
+
+		for (auto list : lists)
+			for (int id : *list)
+				shared[id] = 0;
+	}
+
+	sort(found.begin(), found.end(), [&](const pair<int, int>& a, const pair<int, int>& b)
+	{
+		return a.first != b.first ? a.first < b.first : keys[a.second] < keys[b.second];
+	});
+
+	for (auto& f : found)
+	{
+		string suggestion = entries[f.second]->getKey();
+		if (find(res.begin(), res.end(), suggestion) == res.end())
+			res.push_back(suggestion);
+		if ((int)res.size() >= count) break;
+	}
+	return res;
+}
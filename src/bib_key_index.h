@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <memory>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+// Trigram index over the entry keys for suggestions of similar keys; keys are
+// compared case-insensitively by edit distance. The lists of keys are split by
+// the key length, so that a query reads the lists of similar lengths only.
+class BibKeyIndex
+{
+	vector<string> keys;
+	vector<const BibEntry*> entries;
+	unordered_map<unsigned long long, vector<int> > postings;
+	// shared trigram counts of the current query; not thread-safe
+	mutable vector<unsigned char> shared;
+
+private:
+	BibKeyIndex(const BibKeyIndex&);
+	BibKeyIndex& operator = (const BibKeyIndex&);
+	BibKeyIndex() {}
+
+	void Insert(const string& key, const BibEntry* entry);
+
+	static vector<unsigned int> Trigrams(const string& key);
+	static unsigned long long PostingKey(unsigned int gram, size_t length);
+	static int Distance(const string& s1, const string& s2, int bound);
+
+public:
+	// keys are expected in lower case, as in BibDatabase::keyEntryMap
+	static unique_ptr<BibKeyIndex> Create(const map<string, BibEntry*>& keyEntryMap)
+	{
+		auto res = unique_ptr<BibKeyIndex>(new BibKeyIndex());
+		res->keys.reserve(keyEntryMap.size());
+		res->entries.reserve(keyEntryMap.size());
+		for (auto& it : keyEntryMap)
+			res->Insert(it.first, it.second);
+		return res;
+	}
+
+	// the current keys of at most count entries closest to the key
+	vector<string> Suggest(const string& key, int count) const;
+};
@@ -0,0 +1,102 @@
+#include "bib_key_registry.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <fstream>
+#include <map>
+#include <cstdio>
+
+using namespace string_utilities;
+
+static const string REGISTRY_HEADER = "# BTStyle key registry: fingerprint, key";
+
+void BibKeyRegistry::Load()
+{
+	ifstream is(filename.c_str(), ios::in);
+	if (!is.good())
+	{
+		Logger::Debug("key registry '" + filename + "' not found; creating a new one");
+		return;
+	}
+
+	string line;
+	int lineNumber = 0;
+	while (getline(is, line))
+	{
+		lineNumber++;
+		line = trim(line);
+		if (line == "" || line[0] == '#') continue;
+
+		size_t tab = line.find('\t');
+		Logger::Error(tab != string::npos, "invalid line " + to_string(lineNumber) + " in key registry '" + filename + "'");
+		Assign(line.substr(0, tab), trim(line.substr(tab + 1)));
+	}
+
+	Logger::Debug("loaded " + to_string(fingerprintKeys.size()) + " keys from registry '" + filename + "'");
+}
+
+string BibKeyRegistry::Fingerprint(const BibEntry* entry)
+{
+	// the type is left out, as preprints become articles
+	const string& title = entry->getTitleKey();
+	if (title == "") return "";
+
+	string s = title;
+	s += '\x00';
+	s += entry->getAuthorKey();
+	s += '\x00';
+	s += trim(entry->getYear());
+
+	char buf[17];
+	snprintf(buf, sizeof(buf), "%016llx", hash64(s));
+	return buf;
+}
+
+string BibKeyRegistry::Lookup(const string& fingerprint) const
+{
+	auto it = fingerprintKeys.find(fingerprint);
+	return (it != fingerprintKeys.end() ? it->second : "");
+}
+
+void BibKeyRegistry::Assign(const string& fingerprint, const string& key)
+{
+	// a key belongs to one fingerprint; stale assignments are dropped
+	string lkey = to_lower(key);
+	auto it = keyFingerprints.find(lkey);
+	if (it != keyFingerprints.end() && it->second != fingerprint)
+		fingerprintKeys.erase(it->second);
+
+	auto old = fingerprintKeys.find(fingerprint);
+	if (old != fingerprintKeys.end())
+		keyFingerprints.erase(to_lower(old->second));
+
+	fingerprintKeys[fingerprint] = key;
+	keyFingerprints[lkey] = fingerprint;
+}
+
+void BibKeyRegistry::Save() const
+{
+	// the registry is replaced only when completely written
+	string tmpFilename = filename + ".tmp";
+	ofstream os(tmpFilename.c_str(), ios::out);
+	Logger::Error(os.good(), "can't write key registry '" + tmpFilename + "'");
+
+	// sorted by key, so that the file is diff-friendly
+	map<string, string> sorted;
+	for (auto& it : fingerprintKeys)
+		sorted[it.second] = it.first;
+
+	os << REGISTRY_HEADER << "\n";
+	for (auto& it : sorted)
+		os << it.second << "\t" << it.first << "\n";
+	os.close();
+	Logger::Error(!os.fail(), "can't write key registry '" + tmpFilename + "'");
+
+	// rename replaces an existing file atomically, except on Windows
+#if defined _WIN32
+	remove(filename.c_str());
+#endif
+	Logger::Error(rename(tmpFilename.c_str(), filename.c_str()) == 0, "can't replace key registry '" + filename + "'");
+	Logger::Debug("saved " + to_string(fingerprintKeys.size()) + " keys to registry '" + filename + "'");
+}
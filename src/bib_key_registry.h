@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <unordered_map>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+// Persistent assignment of keys to entry fingerprints, so that the keys of
+// existing entries do not change when the bibliography is extended
+class BibKeyRegistry
+{
+	string filename;
+	unordered_map<string, string> fingerprintKeys;
+	unordered_map<string, string> keyFingerprints;
+
+private:
+	BibKeyRegistry(const BibKeyRegistry&);
+	BibKeyRegistry& operator = (const BibKeyRegistry&);
+	BibKeyRegistry(const string& filename): filename(filename) {}
+
+	void Load();
+
+public:
+	static unique_ptr<BibKeyRegistry> Create(const string& filename)
+	{
+		auto res = unique_ptr<BibKeyRegistry>(new BibKeyRegistry(filename));
+		res->Load();
+		return res;
+	}
+
+	// an empty string for entries without a title
+	static string Fingerprint(const BibEntry* entry);
+
+	string Lookup(const string& fingerprint) const;
+	void Assign(const string& fingerprint, const string& key);
+	void Save() const;
+};
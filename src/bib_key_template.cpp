@@ -0,0 +1,260 @@
+#include "bib_key_template.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+#include "unicode_latex.h"
+
+#include <cctype>
+#include <cstdlib>
+
+using namespace string_utilities;
+
+void BibKeyTemplate::Compile(const string& spec)
+{
+	// the former styles are expressed as templates
+	string s = spec;
+	if (s == "alpha") s = "{auth.alpha}{year.short}";
+	else if (s == "abstract") s = "{auth.last:word1}{year:pre=-}";
+
+	ops.clear();
+	size_t i = 0;
+	while (i < s.length())
+	{
+		if (s[i] == '{')
+		{
+			size_t close = s.find('}', i);
+			Logger::Error(close != string::npos, "unclosed '{' in key template '" + spec + "'");
+			ops.push_back(CompileOp(spec, s.substr(i + 1, close - i - 1)));
+			i = close + 1;
+			continue;
+		}
+
+		Logger::Error(s[i] != '}', "unexpected '}' in key template '" + spec + "'");
+		if (ops.empty() || ops.back().source != literal)
+		{
+			KeyOp op;
+			op.source = literal;
+			op.index = 0;
+			ops.push_back(op);
+		}
+		ops.back().text += s[i++];
+	}
+
+	Logger::Error(!ops.empty(), "invalid key template '" + spec + "'");
+}
+
+BibKeyTemplate::KeyOp BibKeyTemplate::CompileOp(const string& spec, const string& s)
+{
+	KeyOp op;
+	op.index = 0;
+
+	auto tokens = split(s, ":");
+	string name = to_lower(trim(tokens[0]));
+	string selector;
+	size_t dot = name.find('.');
+	if (dot != string::npos)
+	{
+		selector = name.substr(dot + 1);
+		name = name.substr(0, dot);
+	}
+	Logger::Error(name != "", "empty extractor in key template '" + spec + "'");
+
+	if (name == "auth")
+	{
+		usesAuthors = true;
+		if (selector == "" || selector == "last") op.source = authorLast;
+		else if (selector == "first") op.source = authorFirst;
+		else if (selector == "alpha") op.source = authorAlpha;
+		else Logger::Error("invalid selector '" + selector + "' in key template '" + spec + "'");
+	}
+	else if (name == "year")
+	{
+		if (selector == "") op.source = year;
+		else if (selector == "short") op.source = yearShort;
+		else Logger::Error("invalid selector '" + selector + "' in key template '" + spec + "'");
+	}
+	else if (name == "title" && selector != "")
+	{
+		Logger::Error(startsWith(selector, "word") && isDigits(selector.substr(4)) && atoi(selector.c_str() + 4) > 0, 
+			"invalid selector '" + selector + "' in key template '" + spec + "'");
+		op.source = titleWord;
+		op.index = atoi(selector.c_str() + 4);
+	}
+	else
+	{
+		Logger::Error(selector == "", "invalid selector '" + selector + "' in key template '" + spec + "'");
+		op.source = field;
+		op.text = name;
+	}
+
+	for (int i = 1; i < (int)tokens.size(); i++)
+	{
+		string m = tokens[i];
+		if (startsWith(m, "pre="))
+		{
+			op.prefix = m.substr(4);
+			continue;
+		}
+
+		m = to_lower(trim(m));
+		if (m == "lower") op.modifiers.push_back(make_pair(lower, 0));
+		else if (m == "upper") op.modifiers.push_back(make_pair(upper, 0));
+		else if (m == "alpha") op.modifiers.push_back(make_pair(alpha, 0));
+		else if (m == "alnum") op.modifiers.push_back(make_pair(alnum, 0));
+		else if (m == "fold") op.modifiers.push_back(make_pair(fold, 0));
+		else if (startsWith(m, "word") && isDigits(m.substr(4)) && atoi(m.c_str() + 4) > 0) op.modifiers.push_back(make_pair(word, atoi(m.c_str() + 4)));
+		else if (isDigits(m) && atoi(m.c_str()) > 0) op.modifiers.push_back(make_pair(truncate, atoi(m.c_str())));
+		else Logger::Error("invalid modifier '" + m + "' in key template '" + spec + "'");
+	}
+
+	return op;
+}
+
+string BibKeyTemplate::AlphaLabel(const vector<Author>& authors)
+{
+	string author;
+	if (authors.empty()) 
+	{
+		author = "";
+	}
+	else if ((int)authors.size() == 1) 
+	{
+		size_t i = 0;
+		string s = "";
+		while (i < authors[0].last.length() && s.length() < 3)
+		{
+			if (isalpha(authors[0].last[i]))
+				s += authors[0].last[i];
+			i++;
+		}
+		author = s;
+	}
+	else
+	{
+		for (int i = 0; i < (int)authors.size() && i < 5; i++)
+			if (authors[i].last != "others")	
+			{
+				size_t j = 0;
+				while (j < authors[i].last.length() && !isalpha(authors[i].last[j]))
+					j++;
+				if (j < authors[i].last.length())
+					author += authors[i].last[j];
+			}
+		if ((int)authors.size() > 6) author += "+";
+		else if ((int)authors.size() == 6) author += authors[5].last[0];
+	}
+
+	return author;
+}
+
+string BibKeyTemplate::Word(const string& s, int index, bool significant)
+{
+	size_t i = 0, n = s.length();
+	while (i < n)
+	{
+		while (i < n && isspace((unsigned char)s[i]))
+			i++;
+		size_t start = i;
+		while (i < n && !isspace((unsigned char)s[i]))
+			i++;
+		if (start == i) break;
+
+		string w = s.substr(start, i - start);
+		if (significant && isStopWord(w)) continue;
+		if (--index == 0) return w;
+	}
+
+	return "";
+}
+
+string BibKeyTemplate::Modify(const string& s, MODIFIER modifier, int arg)
+{
+	string res;
+	switch (modifier)
+	{
+	case lower:
+		return to_lower(s);
+	case upper:
+		for (char c : s)
+			res += char(toupper((unsigned char)c));
+		return res;
+	case alpha:
+		for (char c : s)
+			if (isalpha((unsigned char)c)) res += c;
+		return res;
+	case alnum:
+		for (char c : s)
+			if (isalnum((unsigned char)c)) res += c;
+		return res;
+	case fold:
+		for (char c : unicode_latex::collationKey(s))
+			if (c != ' ') res += c;
+		return res;
+	case word:
+		return Word(s, arg, false);
+	case truncate:
+		// the first characters, not splitting UTF-8 sequences
+		for (char c : s)
+		{
+			bool start = ((unsigned char)c & 0xC0) != 0x80;
+			if (start && arg-- == 0) break;
+			res += c;
+		}
+		return res;
+	}
+
+	return s;
+}
+
+string BibKeyTemplate::Evaluate(const BibEntry* entry, const vector<Author>& authors, const KeyOp& op) const
+{
+	switch (op.source)
+	{
+	case literal:
+		return op.text;
+	case field:
+		if (op.text == "key") return entry->getKey();
+		if (op.text == "type") return entry->getType();
+		return (entry->hasField(op.text) ? entry->getExpandedField(op.text) : "");
+	case authorLast:
+		return (authors.empty() ? "" : authors[0].last);
+	case authorFirst:
+		return (authors.empty() ? "" : authors[0].first);
+	case authorAlpha:
+		return AlphaLabel(authors);
+	case year:
+		return entry->getYear();
+	case yearShort:
+	{
+		string y = entry->getYear();
+		return ((int)y.length() == 4 ? y.substr(2, 2) : y);
+	}
+	case titleWord:
+		return Word(replace(replace(entry->getTitle(), "{", ""), "}", ""), op.index, true);
+	}
+
+	return "";
+}
+
+string BibKeyTemplate::Key(const BibEntry* entry) const
+{
+	if (usesAuthors && !entry->hasField("author"))
+		return "";
+
+	vector<Author> authors;
+	if (usesAuthors)
+		authors = entry->getAuthors();
+
+	string res;
+	for (auto& op : ops)
+	{
+		string value = Evaluate(entry, authors, op);
+		for (auto& m : op.modifiers)
+			value = Modify(value, m.first, m.second);
+
+		if (value != "")
+			res += (op.source == literal ? "" : op.prefix) + value;
+	}
+
+	return res;
+}
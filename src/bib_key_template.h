@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+// A compiled key template such as "{auth.last:lower}{year}{title.word1:lower}".
+// The template is parsed once into a sequence of extractor ops, which are
+// evaluated for every entry.
+class BibKeyTemplate
+{
+	enum SOURCE {literal, field, authorLast, authorFirst, authorAlpha, year, yearShort, titleWord};
+	enum MODIFIER {lower, upper, alpha, alnum, fold, word, truncate};
+
+	struct KeyOp
+	{
+		SOURCE source;
+		// literal text or field name
+		string text;
+		int index;
+		vector<pair<MODIFIER, int> > modifiers;
+		// prepended to non-empty values only
+		string prefix;
+	};
+
+	vector<KeyOp> ops;
+	bool usesAuthors;
+
+private:
+	BibKeyTemplate(const BibKeyTemplate&);
+	BibKeyTemplate& operator = (const BibKeyTemplate&);
+	BibKeyTemplate(): usesAuthors(false) {}
+
+	void Compile(const string& spec);
+	KeyOp CompileOp(const string& spec, const string& op);
+	string Evaluate(const BibEntry* entry, const vector<Author>& authors, const KeyOp& op) const;
+
+	static string AlphaLabel(const vector<Author>& authors);
+	static string Word(const string& s, int index, bool significant);
+	static string Modify(const string& s, MODIFIER modifier, int arg);
+
+public:
+	static unique_ptr<BibKeyTemplate> Create(const string& spec)
+	{
+		auto res = unique_ptr<BibKeyTemplate>(new BibKeyTemplate());
+		res->Compile(spec);
+		return res;
+	}
+
+	// an empty string if the key cannot be generated for the entry
+	string Key(const BibEntry* entry) const;
+};
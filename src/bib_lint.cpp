@@ -0,0 +1,376 @@
+#include "bib_lint.h"
+#include "bib_database.h"
+#include "bib_macro_table.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <cassert>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <ctime>
+#include <cstdlib>
+
+using namespace string_utilities;
+
+void BibDatabase::Lint(const BibLinter& linter, const string& reportFile) const
+{
+	// entries are checked in parallel; the issues are reported in the order of the entries
+	int n = (int)entries.size();
+	vector<vector<LintIssue> > issues(n);
+	#pragma omp parallel for schedule(dynamic, 256)
+	for (int i = 0; i < n; i++)
+		issues[i] = linter.Check(entries[i]);
+
+	map<string, int> ruleCounts;
+	for (auto& entryIssues : issues)
+		for (auto& issue : entryIssues)
+		{
+			Logger::Warning(issue.message + " in " + issue.key);
+			ruleCounts[issue.rule]++;
+		}
+
+	string summary;
+	for (auto& it : ruleCounts)
+		summary += (summary.empty() ? ": " : ", ") + it.first + " " + to_string(it.second);
+	Logger::Debug("checked " + to_string(n) + " entries" + summary);
+
+	if (reportFile == "") return;
+
+	ofstream os(reportFile.c_str(), ios::out);
+	Logger::Error(os.good(), "can't write lint report '" + reportFile + "'");
+	os << "key\trule\tfield\tmessage\n";
+	for (auto& entryIssues : issues)
+		for (auto& issue : entryIssues)
+		{
+			string message = replace(replace(replace(issue.message, "\t", " "), "\n", " "), "\r", " ");
+			os << issue.key << "\t" << issue.rule << "\t" << issue.field << "\t" << message << "\n";
+		}
+	Logger::Error(os.good(), "can't write lint report '" + reportFile + "'");
+}
+
+
+namespace {
+
+string CheckYear(const string&, const string& value)
+{
+	static const int CURRENT_YEAR = []()
+	{
+		time_t now = time(nullptr);
+		return localtime(&now)->tm_year + 1900;
+	}();
+
+	string v = trim(value);
+	if (!isInteger(v)) return "invalid year '" + v + "'";
+
+	// forthcoming papers may carry the next year
+	int year = atoi(v.c_str());
+	if (year < 1000 || year > CURRENT_YEAR + 1) return "suspicious year '" + v + "'";
+	return "";
+}
+
+bool IsPageNumber(const string& s)
+{
+	// numbers, roman numerals and article numbers such as e1234 or S12
+	if (s.empty()) return false;
+	for (auto ch : s)
+		if (!isalnum((unsigned char)ch)) return false;
+	return true;
+}
+
+string CheckPages(const string&, const string& value)
+{
+	for (auto& range : split(value, ","))
+	{
+		string r = trim(range);
+		size_t dash = r.find('-');
+		string first = trim(r.substr(0, dash));
+		string last;
+		if (dash != string::npos)
+		{
+			size_t end = r.find_first_not_of('-', dash);
+			last = (end == string::npos ? "" : trim(r.substr(end)));
+		}
+
+		// a trailing '+' stands for the following pages
+		if (dash == string::npos && !first.empty() && first.back() == '+')
+			first.pop_back();
+
+		if (!IsPageNumber(first) || (dash != string::npos && !IsPageNumber(last)))
+			return "invalid pages '" + trim(value) + "'";
+		// page numbers too long for atoi are not compared
+		bool numeric = isDigits(first) && isDigits(last) && first.length() < 10 && last.length() < 10;
+		if (numeric && atoi(first.c_str()) > atoi(last.c_str()))
+			return "decreasing page range '" + r + "'";
+	}
+	return "";
+}
+
+string Digits(const string& s)
+{
+	string res;
+	for (auto ch : s)
+		if (isdigit((unsigned char)ch) || ch == 'X' || ch == 'x')
+			res += (char)toupper((unsigned char)ch);
+		else if (ch != '-' && ch != ' ')
+			return "";
+	return res;
+}
+
+int DigitValue(char ch)
+{
+	return (ch == 'X' ? 10 : ch - '0');
+}
+
+bool IsValidISBN(const string& digits)
+{
+	int sum = 0;
+	if (digits.length() == 10)
+	{
+		for (int i = 0; i < 10; i++)
+		{
+			if (digits[i] == 'X' && i != 9) return false;
+			sum += (10 - i) * DigitValue(digits[i]);
+		}
+		return sum % 11 == 0;
+	}
+
+	if (digits.length() == 13)
+	{
+		for (int i = 0; i < 13; i++)
+		{
+			if (digits[i] == 'X') return false;
+			sum += (i % 2 == 0 ? 1 : 3) * DigitValue(digits[i]);
+		}
+		return sum % 10 == 0;
+	}
+
+	return false;
+}
+
+string CheckISBN(const string&, const string& value)
+{
+	for (auto& isbn : split(value, ",;"))
+		if (!IsValidISBN(Digits(trim(isbn))))
+			return "invalid ISBN '" + trim(isbn) + "'";
+	return "";
+}
+
+string CheckISSN(const string&, const string& value)
+{
+	string digits = Digits(trim(value));
+	bool valid = (digits.length() == 8);
+	int sum = 0;
+	for (int i = 0; valid && i < 8; i++)
+	{
+		valid &= (digits[i] != 'X' || i == 7);
+		sum += (8 - i) * DigitValue(digits[i]);
+	}
+
+	if (!valid || sum % 11 != 0) return "invalid ISSN '" + trim(value) + "'";
+	return "";
+}
+
+string CheckDOI(const string&, const string& value)
+{
+	string doi = trim(value);
+	if (doi.find("doi.org/") != string::npos) return "DOI given as a URL '" + doi + "'";
+
+	// 10.<registrant>/<suffix>
+	size_t slash = doi.find('/');
+	bool valid = startsWith(doi, "10.") && slash != string::npos && slash > 3 && slash + 1 < doi.length();
+	for (size_t i = 3; valid && i < slash; i++)
+		valid &= (isdigit((unsigned char)doi[i]) || doi[i] == '.');
+	for (size_t i = 0; valid && i < doi.length(); i++)
+		valid &= !isspace((unsigned char)doi[i]);
+
+	if (!valid) return "invalid DOI '" + doi + "'";
+	return "";
+}
+
+string CheckEmpty(const string& tag, const string& value)
+{
+	if (trim(value) == "") return "empty field '" + tag + "'";
+	return "";
+}
+
+string CheckCharacters(const string& tag, const string& value)
+{
+	// unescaped percent signs start comments in TeX, except in the verbatim fields
+	bool verbatim = (tag == "url" || tag == "ee" || tag == "doi" || tag == "file");
+
+	int brCount = 0;
+	for (size_t i = 0; i < value.length(); i++)
+	{
+		unsigned char ch = (unsigned char)value[i];
+		if (ch < 0x20 && ch != '\t' && ch != '\n' && ch != '\r')
+			return "control character in field '" + tag + "'";
+		// U+FFFD, the replacement character left by broken conversions
+		if (ch == 0xEF && value.compare(i, 3, "\xEF\xBF\xBD") == 0)
+			return "replacement character in field '" + tag + "'";
+		if (ch == '%' && !verbatim && (i == 0 || value[i - 1] != '\\'))
+			return "unescaped '%' in field '" + tag + "'";
+
+		if (ch == '\\') i++;
+		else if (ch == '{') brCount++;
+		else if (ch == '}' && --brCount < 0) break;
+	}
+
+	if (brCount != 0) return "unbalanced braces in field '" + tag + "'";
+	return "";
+}
+
+}
+
+const BibLinter::Rule BibLinter::RULES[] = {
+	{"required", nullptr, nullptr},
+	{"year", "year", CheckYear},
+	{"pages", "pages", CheckPages},
+	{"isbn", "isbn", CheckISBN},
+	{"issn", "issn", CheckISSN},
+	{"doi", "doi", CheckDOI},
+	{"empty", "*", CheckEmpty},
+	{"characters", "*", CheckCharacters},
+};
+
+string BibLinter::RuleNames()
+{
+	string res;
+	for (auto& rule : RULES)
+		res += (res.empty() ? "" : ", ") + string(rule.name);
+	return res;
+}
+
+void BibLinter::Compile(const string& rules)
+{
+	if (rules == "")
+	{
+		Enable(&RULES[0]);
+		return;
+	}
+
+	for (auto& name : split(rules, ","))
+	{
+		string n = to_lower(trim(name));
+		bool found = false;
+		for (auto& rule : RULES)
+			if (n == "all" || n == rule.name)
+			{
+				Enable(&rule);
+				found = true;
+			}
+
+		Logger::Error(found, "unknown lint rule '" + n + "'; available rules are " + RuleNames());
+	}
+}
+
+void BibLinter::Enable(const Rule* rule)
+{
+	if (rule->tag == nullptr)
+	{
+		if (!checkRequired) CompileRequired();
+		checkRequired = true;
+		return;
+	}
+
+	auto& list = (string(rule->tag) == "*" ? anyTagRules : tagRules[rule->tag]);
+	if (find(list.begin(), list.end(), rule) == list.end())
+		list.push_back(rule);
+}
+
+void BibLinter::CompileRequired()
+{
+	// every field named in a requirement gets a bit
+	for (auto& type : BibEntry::REQUIRED_FIELDS)
+	{
+		for (auto& requirement : type.second)
+		{
+			unsigned long long mask = 0;
+			for (auto& tag : split(requirement, "|"))
+			{
+				auto it = fieldIds.find(tag);
+				if (it == fieldIds.end())
+					it = fieldIds.insert(make_pair(tag, (int)fieldIds.size())).first;
+				assert(it->second < 64);
+				mask |= 1ULL << it->second;
+			}
+
+			requiredMasks[type.first].push_back(mask);
+			requiredNames[type.first].push_back(requirement);
+		}
+	}
+}
+
+unsigned long long BibLinter::FieldMask(const BibEntry* entry) const
+{
+	unsigned long long mask = 0;
+	for (auto& field : entry->fields)
+	{
+		auto it = fieldIds.find(field.first);
+		if (it != fieldIds.end()) mask |= 1ULL << it->second;
+	}
+
+	for (auto& field : entry->inherited)
+	{
+		auto it = fieldIds.find(field.first);
+		if (it != fieldIds.end()) mask |= 1ULL << it->second;
+	}
+	return mask;
+}
+
+void BibLinter::CheckField(const BibEntry* entry, const string& tag, const string& value, const Rule* rule, vector<LintIssue>& issues) const
+{
+	string message = rule->check(tag, value);
+	if (message == "") return;
+
+	LintIssue issue;
+	issue.key = entry->key;
+	issue.rule = rule->name;
+	issue.field = tag;
+	issue.message = message;
+	issues.push_back(issue);
+}
+
+vector<LintIssue> BibLinter::Check(const BibEntry* entry) const
+{
+	vector<LintIssue> issues;
+
+	if (checkRequired)
+	{
+		auto masks = requiredMasks.find(entry->type);
+		if (masks != requiredMasks.end())
+		{
+			unsigned long long present = FieldMask(entry);
+			const vector<string>& names = requiredNames.find(entry->type)->second;
+			for (int i = 0; i < (int)masks->second.size(); i++)
+				if ((present & masks->second[i]) == 0)
+				{
+					LintIssue issue;
+					issue.key = entry->key;
+					issue.rule = "required";
+					issue.field = names[i];
+					issue.message = "missing required field '" + names[i] + "'";
+					issues.push_back(issue);
+				}
+		}
+	}
+
+	if (tagRules.empty() && anyTagRules.empty())
+		return issues;
+
+	for (auto& field : entry->fields)
+	{
+		auto rules = tagRules.find(field.first);
+		if (rules == tagRules.end() && anyTagRules.empty()) continue;
+
+		string value = entry->Expand(field.second);
+		if (rules != tagRules.end())
+			for (auto rule : rules->second)
+				CheckField(entry, field.first, value, rule, issues);
+		for (auto rule : anyTagRules)
+			CheckField(entry, field.first, value, rule, issues);
+	}
+
+	return issues;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+class LintIssue
+{
+public:
+	string key;
+	string rule;
+	string field;
+	string message;
+};
+
+// Validation rules applied to every entry. The required fields of the entry types
+// are compiled into bitmasks of field ids, and the field rules are dispatched by
+// tag, so that an entry is checked with one bitmask test per requirement and a
+// single scan of its fields.
+class BibLinter
+{
+	// a field rule returns an empty string for a valid value
+	typedef string (*FieldCheck)(const string& tag, const string& value);
+
+	struct Rule
+	{
+		const char* name;
+		// the checked field, or "*" for all fields; nullptr for the required fields
+		const char* tag;
+		FieldCheck check;
+	};
+
+	static const Rule RULES[];
+
+	bool checkRequired;
+	unordered_map<string, int> fieldIds;
+	// the alternatives of every requirement of an entry type, e.g. author|editor
+	unordered_map<string, vector<unsigned long long> > requiredMasks;
+	unordered_map<string, vector<string> > requiredNames;
+	unordered_map<string, vector<const Rule*> > tagRules;
+	vector<const Rule*> anyTagRules;
+
+private:
+	BibLinter(const BibLinter&);
+	BibLinter& operator = (const BibLinter&);
+	BibLinter(): checkRequired(false) {}
+
+	void Compile(const string& rules);
+	void Enable(const Rule* rule);
+	void CompileRequired();
+	unsigned long long FieldMask(const BibEntry* entry) const;
+	void CheckField(const BibEntry* entry, const string& tag, const string& value, const Rule* rule, vector<LintIssue>& issues) const;
+
+public:
+	// rules are listed by name (comma-separated) or "all"; the required fields are checked by default
+	static unique_ptr<BibLinter> Create(const string& rules)
+	{
+		auto res = unique_ptr<BibLinter>(new BibLinter());
+		res->Compile(rules);
+		return res;
+	}
+
+	vector<LintIssue> Check(const BibEntry* entry) const;
+
+	static string RuleNames();
+};
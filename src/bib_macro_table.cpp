@@ -0,0 +1,129 @@
+#include "bib_macro_table.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <algorithm>
+
+using namespace string_utilities;
+
+// the month abbreviations predefined by the standard styles
+static const char* MONTHS[][2] = {
+	{"jan", "January"}, {"feb", "February"}, {"mar", "March"}, {"apr", "April"},
+	{"may", "May"}, {"jun", "June"}, {"jul", "July"}, {"aug", "August"},
+	{"sep", "September"}, {"oct", "October"}, {"nov", "November"}, {"dec", "December"}
+};
+
+BibMacroTable::BibMacroTable(): cached(false)
+{
+	for (auto& month : MONTHS)
+		Define(month[0], "{" + string(month[1]) + "}");
+}
+
+void BibMacroTable::Define(const string& tag, const string& value)
+{
+	// macros defined in terms of the redefined one have to be expanded again
+	if (cached)
+	{
+		for (auto& it : macros)
+			it.second.ready = false;
+		cached = false;
+	}
+
+	Macro& macro = macros[to_lower(trim(tag))];
+	macro.value = value;
+	macro.expanded = "";
+	macro.ready = false;
+}
+
+bool BibMacroTable::IsDefined(const string& tag) const
+{
+	return macros.count(to_lower(trim(tag))) > 0;
+}
+
+vector<string> BibMacroTable::SplitConcatenation(const string& value)
+{
+	vector<string> result;
+
+	int start = 0;
+	int brCount = 0;
+	bool insideQuotes = false;
+	for (int i = 0; i < (int)value.length(); i++)
+	{
+		char c = value[i];
+		if (c == '{') brCount++;
+		else if (c == '}') brCount--;
+		else if (c == '"' && brCount == 0) insideQuotes = !insideQuotes;
+		else if (c == '#' && brCount == 0 && !insideQuotes)
+		{
+			result.push_back(trim(value.substr(start, i - start)));
+			start = i + 1;
+		}
+	}
+
+	result.push_back(trim(value.substr(start)));
+	return result;
+}
+
+string BibMacroTable::Expand(const string& value) const
+{
+	// most values are a single delimited string
+	if (value.find('#') == string::npos && !value.empty() && (value[0] == '{' || value[0] == '"'))
+		return unquote(value);
+
+	vector<string> path;
+	return Expand(value, path);
+}
+
+string BibMacroTable::Expand(const string& value, vector<string>& path) const
+{
+	string res;
+	for (auto& part : SplitConcatenation(value))
+	{
+		if (part.empty()) continue;
+
+		if (part[0] == '{' || part[0] == '"' || isInteger(part))
+			res += unquote(part);
+		else
+			res += ExpandMacro(part, path);
+	}
+
+	return res;
+}
+
+string BibMacroTable::ExpandMacro(const string& name, vector<string>& path) const
+{
+	string lname = to_lower(name);
+	auto it = macros.find(lname);
+	// undefined macros are kept as they are
+	if (it == macros.end())
+		return name;
+
+	const Macro& macro = it->second;
+	string res;
+	bool ready;
+	#pragma omp critical(macros)
+	{
+		ready = macro.ready;
+		if (ready) res = macro.expanded;
+	}
+	if (ready) return res;
+
+	if (find(path.begin(), path.end(), lname) != path.end())
+	{
+		Logger::Warning("string abbreviation '" + name + "' is defined in terms of itself");
+		return "";
+	}
+
+	path.push_back(lname);
+	res = Expand(macro.value, path);
+	path.pop_back();
+
+	#pragma omp critical(macros)
+	{
+		macro.expanded = res;
+		macro.ready = true;
+		cached = true;
+	}
+	return res;
+}
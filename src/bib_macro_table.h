@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+using namespace std;
+
+// @string abbreviations by (case-insensitive) name. Values keep their raw form,
+// e.g. jacm or jan # "~15"; the expansion of a macro is resolved on first use
+// and cached until the macro is redefined.
+class BibMacroTable
+{
+	struct Macro
+	{
+		string value;
+		mutable string expanded;
+		mutable bool ready;
+	};
+
+	unordered_map<string, Macro> macros;
+	// whether any expansion is cached, so that definitions made while parsing are cheap
+	mutable bool cached;
+
+private:
+	BibMacroTable(const BibMacroTable&);
+	BibMacroTable& operator = (const BibMacroTable&);
+	BibMacroTable();
+
+	string Expand(const string& value, vector<string>& path) const;
+	string ExpandMacro(const string& name, vector<string>& path) const;
+
+public:
+	static unique_ptr<BibMacroTable> Create()
+	{
+		return unique_ptr<BibMacroTable>(new BibMacroTable());
+	}
+
+	void Define(const string& tag, const string& value);
+	bool IsDefined(const string& tag) const;
+
+	// the resolved text of a raw field value, without delimiters
+	string Expand(const string& value) const;
+
+	// parts of a raw value joined by '#'
+	static vector<string> SplitConcatenation(const string& value);
+};
@@ -0,0 +1,205 @@
+#include "bib_merge.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <algorithm>
+#include <queue>
+
+using namespace string_utilities;
+
+bool BibMerge::ReadEntry(Source& source)
+{
+	BibDatabase& db = *source.db;
+	size_t count = db.entries.size();
+	while (db.entries.size() == count)
+	{
+		if (!parser.ParseNextItem(*source.stream, db, source.lineNumber, source.bytes))
+		{
+			source.eof = true;
+			return false;
+		}
+	}
+
+	BibEntry* entry = db.entries.back();
+	string lkey = to_lower(entry->key);
+	if (!db.keyEntryMap.count(lkey))
+		db.keyEntryMap[lkey] = entry;
+	return true;
+}
+
+BibEntry* BibMerge::FindRef(Source& source, const BibEntry* entry, bool& held)
+{
+	held = false;
+	auto it = entry->fields.find("crossref");
+	if (it == entry->fields.end()) return nullptr;
+
+	string lref = to_lower(unquote(it->second));
+	auto ref = source.db->keyEntryMap.find(lref);
+	if (ref != source.db->keyEntryMap.end()) return ref->second;
+
+	// the target may follow, unless it is written already or the file is read
+	held = !source.eof && !keys.count(lref);
+	return nullptr;
+}
+
+void BibMerge::ResolveRefs(Source& source, BibEntry* entry)
+{
+	bool held;
+	vector<BibEntry*> chain(1, entry);
+	while (BibEntry* parent = FindRef(source, chain.back(), held))
+	{
+		if (find(chain.begin(), chain.end(), parent) != chain.end())
+		{
+			Logger::Warning("crossref cycle through " + entry->key + " in " + source.filename);
+			break;
+		}
+		chain.push_back(parent);
+	}
+
+	if (chain.size() == 1 && entry->fields.count("crossref"))
+	{
+		string ref = unquote(entry->fields["crossref"]);
+		if (keys.count(to_lower(ref)))
+			Logger::Warning("crossref '" + ref + "' in " + entry->key + " precedes it in " + source.filename + "; its fields are not inherited");
+		else
+			Logger::Warning("non-existing crossref '" + ref + "' in " + entry->key + " in " + source.filename);
+	}
+
+	// the inheritance tables are rebuilt from the top of the chain, as in BuildCrossrefGraph
+	for (int i = (int)chain.size() - 1; i >= 0; i--)
+	{
+		BibEntry* e = chain[i];
+		e->refEntry = (i + 1 < (int)chain.size() ? chain[i + 1] : nullptr);
+		e->inherited.clear();
+		if (e->refEntry == nullptr) continue;
+
+		e->inherited = e->refEntry->inherited;
+		for (auto& f : e->refEntry->fields)
+			if (f.first != "crossref")
+				e->inherited[f.first] = e->refEntry;
+	}
+}
+
+bool BibMerge::NextEntry(Source& source, string& key)
+{
+	BibDatabase& db = *source.db;
+
+	// the written entry leaves the buffer
+	if (source.current != nullptr)
+	{
+		auto it = db.keyEntryMap.find(to_lower(source.current->key));
+		if (it != db.keyEntryMap.end() && it->second == source.current)
+			db.keyEntryMap.erase(it);
+		db.entries.erase(db.entries.begin());
+		delete source.current;
+		source.current = nullptr;
+	}
+
+	if (db.entries.empty() && !ReadEntry(source))
+		return false;
+
+	// sorted files have the crossref targets after their children, so an entry
+	// is held until its crossref chain is read and its key can be computed
+	BibEntry* entry = db.entries[0];
+	const BibEntry* cur = entry;
+	size_t steps = 0;
+	while (cur != nullptr && steps <= db.entries.size())
+	{
+		bool held;
+		const BibEntry* parent = FindRef(source, cur, held);
+		if (held)
+		{
+			ReadEntry(source);
+		}
+		else
+		{
+			cur = parent;
+			steps++;
+		}
+	}
+
+	ResolveRefs(source, entry);
+	key = spec.Key(entry);
+
+	// the keys of parents are raised above the ones of their children, as in SortEntries
+	string lkey = to_lower(entry->getKey());
+	auto raised = source.childKeys.find(lkey);
+	if (raised != source.childKeys.end())
+	{
+		if (key <= raised->second)
+			key = raised->second + '\xff';
+		source.childKeys.erase(raised);
+	}
+	if (entry->refEntry != nullptr)
+	{
+		string& childKey = source.childKeys[to_lower(entry->refEntry->key)];
+		if (childKey < key) childKey = key;
+	}
+
+	Logger::Warning(source.lastKey <= key, "entry " + entry->getKey() + " in " + source.filename + " is out of order");
+	source.lastKey = key;
+	source.current = entry;
+
+	// duplicate keys are reported as soon as they are seen
+	if (!keys.insert(lkey).second)
+		Logger::Warning("duplicate key " + entry->getKey() + " in " + source.filename);
+
+	return true;
+}
+
+void BibMerge::Merge(const vector<string>& filenames, ostream& os)
+{
+	// the heap holds the current key of every source; ties go to the earlier source
+	typedef pair<string, int> HeapItem;
+	priority_queue<HeapItem, vector<HeapItem>, greater<HeapItem> > heap;
+
+	for (auto& filename : filenames)
+	{
+		unique_ptr<Source> source(new Source());
+		source->filename = filename;
+		source->stream = unique_ptr<ifstream>(new ifstream(filename.c_str(), ios::in));
+		Logger::Error(source->stream->good(), "can't open input file '" + filename + "'");
+		source->db = BibDatabase::Create();
+		source->lineNumber = 1;
+		source->bytes = 0;
+		source->eof = false;
+		source->current = nullptr;
+		sources.push_back(move(source));
+
+		string key;
+		if (NextEntry(*sources.back(), key))
+			heap.push(make_pair(key, (int)sources.size() - 1));
+	}
+
+	// preambles and abbreviations precede the entries in sorted files
+	auto head = BibDatabase::Create();
+	for (auto& source : sources)
+		head->MoveItems(*source->db);
+	parser.WriteHead(os, *head);
+
+	while (!heap.empty())
+	{
+		int i = heap.top().second;
+		heap.pop();
+		parser.Write(os, sources[i]->current);
+		entryCount++;
+
+		string key;
+		if (NextEntry(*sources[i], key))
+			heap.push(make_pair(key, i));
+	}
+
+	auto tail = BibDatabase::Create();
+	for (auto& source : sources)
+		tail->MoveItems(*source->db);
+	if (!tail->preambles.empty() || !tail->abbrv.empty())
+	{
+		Logger::Warning("preambles or string abbreviations after entries are written at the end");
+		parser.WriteHead(os, *tail);
+	}
+	head->MoveItems(*tail);
+	parser.WriteTail(os, *head);
+
+	Logger::Info("merged " + to_string(entryCount) + " entries from " + to_string(sources.size()) + " files");
+}
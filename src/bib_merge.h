@@ -0,0 +1,58 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "bib_database.h"
+#include "bib_parser.h"
+#include "bib_sort.h"
+
+using namespace std;
+
+// Streaming k-way merge of bibliographies sorted with the same specification
+class BibMerge
+{
+	struct Source
+	{
+		string filename;
+		unique_ptr<ifstream> stream;
+		unique_ptr<BibDatabase> db;
+		int lineNumber;
+		long long bytes;
+		bool eof;
+		string lastKey;
+		// the entry on the heap, the first one of the buffered entries
+		BibEntry* current;
+		// the largest key of the children of a parent that is not read yet, by the key of the parent
+		unordered_map<string, string> childKeys;
+	};
+
+	const BibParser& parser;
+	const BibSortSpec& spec;
+
+	vector<unique_ptr<Source> > sources;
+	unordered_set<string> keys;
+	long long entryCount;
+
+private:
+	BibMerge(const BibMerge&);
+	BibMerge& operator = (const BibMerge&);
+	BibMerge(const BibParser& parser, const BibSortSpec& spec): parser(parser), spec(spec), entryCount(0) {}
+
+	bool NextEntry(Source& source, string& key);
+	bool ReadEntry(Source& source);
+	BibEntry* FindRef(Source& source, const BibEntry* entry, bool& held);
+	void ResolveRefs(Source& source, BibEntry* entry);
+
+public:
+	static unique_ptr<BibMerge> Create(const BibParser& parser, const BibSortSpec& spec)
+	{
+		return unique_ptr<BibMerge>(new BibMerge(parser, spec));
+	}
+
+	void Merge(const vector<string>& filenames, ostream& os);
+};
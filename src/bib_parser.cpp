@@ -12,36 +12,52 @@
 using namespace string_utilities;
 
 void BibParser::Read(const string& filename, BibDatabase& db) const
+{
+	Read(filename, db, nullptr);
+}
+
+void BibParser::Read(const string& filename, BibDatabase& db, const function<void(long long)>& onItem) const
 {
 	if (filename != "")
 	{
 		ifstream fileStream;
 		fileStream.open(filename.c_str(), ios::in);
 		Logger::Error(fileStream != 0, "can't open input file '" + filename + "'");
-		Read(fileStream, db);
+		Read(fileStream, db, onItem);
 		fileStream.close();
 
 		db.inputFilename = filename;
 	}
 	else
 	{
-		Read(cin, db);
+		Read(cin, db, onItem);
 	}
 }
 
-void BibParser::Read(istream& is, BibDatabase& db) const
+void BibParser::Read(istream& is, BibDatabase& db, const function<void(long long)>& onItem) const
 {
-	int bytes = ParseItems(is, db);
+	long long bytes = ParseItems(is, db, onItem);
 	db.inputFilesize = bytes;
 }
 
-int BibParser::ParseItems(istream& is, BibDatabase& info) const
+long long BibParser::ParseItems(istream& is, BibDatabase& info, const function<void(long long)>& onItem) const
+{
+	int lineNumber = 1;
+	long long symbolCount = 0;
+	while (ParseNextItem(is, info, lineNumber, symbolCount))
+	{
+		if (onItem)
+			onItem(symbolCount);
+	}
+
+	return symbolCount;
+}
+
+bool BibParser::ParseNextItem(istream& is, BibDatabase& info, int& lineNumber, long long& symbolCount) const
 {
 	char ch;
 	string s = "";
 	int brCount = 0;
-	int lineNumber = 1;
-	int symbolCount = 0;
 	while (is.get(ch))
 	{
 		s += ch;
@@ -60,13 +76,13 @@ int BibParser::ParseItems(istream& is, BibDatabase& info) const
 			if (brCount == 0)
 			{
 				ParseItem(trim(s), info);
-				s = "";
+				return true;
 			}
 		}
 	}
 
 	Logger::Error(brCount == 0, "curly braces do not match at line " + to_string(lineNumber));
-	return symbolCount;
+	return false;
 }
 
 void BibParser::ParseItem(const string& s, BibDatabase& info) const
@@ -95,6 +111,7 @@ void BibParser::ParseItem(const string& s, BibDatabase& info) const
 
 		BibAbbrv* abbrv = new BibAbbrv(tag, value);
 		info.abbrv.push_back(abbrv);
+		info.macros->Define(tag, value);
 	}
 	else if (type == "comment")
 	{
@@ -113,6 +130,7 @@ void BibParser::ParseItem(const string& s, BibDatabase& info) const
 
 		string key = kv[0];
 		BibEntry* entry = new BibEntry(type, key);
+		entry->macros = info.macros.get();
 		for (int i = 1; i < (int)kv.size(); i++)
 		{
 			string tag, value;
@@ -255,6 +273,11 @@ void BibParser::ParseTag(const string& key, const string& s, string& tag, string
 }
 
 void BibParser::Write(const string& filename, const BibDatabase& db) const
+{
+	Write(filename, [&](ostream& os) { Write(os, db); });
+}
+
+void BibParser::Write(const string& filename, const function<void(ostream&)>& writer) const
 {
 	if (filename != "")
 	{
@@ -262,16 +285,29 @@ void BibParser::Write(const string& filename, const BibDatabase& db) const
 		string newfile = filename + ".new";
 		fileStream.open(newfile.c_str(), ios::out);
 		Logger::Error(fileStream != 0, "can't create output file '" + newfile + "'");
-		Write(fileStream, db);
+		writer(fileStream);
 		fileStream.close();
 	}
 	else
 	{
-		Write(cout, db);
+		writer(cout);
 	}
 }
 
 void BibParser::Write(ostream& os, const BibDatabase& db) const
+{
+	WriteHead(os, db);
+
+	if (!db.entries.empty())
+	{
+		for (auto i : db.entries)
+			Write(os, i);
+	}
+
+	WriteTail(os, db);
+}
+
+void BibParser::WriteHead(ostream& os, const BibDatabase& db) const
 {
 	if (!db.preambles.empty())
 	{
@@ -288,13 +324,10 @@ void BibParser::Write(ostream& os, const BibDatabase& db) const
 	
 		os << endl << endl;
 	}
+}
 
-	if (!db.entries.empty())
-	{
-		for (auto i : db.entries)
-			Write(os, i);
-	}
-
+void BibParser::WriteTail(ostream& os, const BibDatabase& db) const
+{
 	if (!db.comments.empty())
 	{
 		os << endl;
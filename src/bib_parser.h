@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <functional>
 
 #include "bib_database.h"
 
@@ -22,12 +23,22 @@ public:
 	void Read(const string& filename, BibDatabase& db) const;
 	void Write(const string& filename, const BibDatabase& db) const;
 
+	// streaming: onItem is invoked after every parsed item with the number of bytes read so far
+	void Read(const string& filename, BibDatabase& db, const function<void(long long)>& onItem) const;
+	void Write(const string& filename, const function<void(ostream&)>& writer) const;
+	void WriteHead(ostream& os, const BibDatabase& db) const;
+	void WriteTail(ostream& os, const BibDatabase& db) const;
+	void Write(ostream& os, const BibEntry* entry) const;
+
+	// incremental reading: parses the next item of the stream into db, returns false at the end
+	bool ParseNextItem(istream& is, BibDatabase& db, int& lineNumber, long long& bytes) const;
+
 	BibEntry* ParseBibEntry(const string& s) const;
 
 private:
 	//reading
-	void Read(istream& is, BibDatabase& db) const;
-	int ParseItems(istream& is, BibDatabase& info) const;
+	void Read(istream& is, BibDatabase& db, const function<void(long long)>& onItem) const;
+	long long ParseItems(istream& is, BibDatabase& info, const function<void(long long)>& onItem) const;
 	void ParseItem(const string& s, BibDatabase& info) const;
 	void ParseTypeContent(const string& s, string& type, string& content) const;
 	vector<string> SplitTags(const string& s) const;
@@ -38,6 +49,5 @@ private:
 	void Write(ostream& os, const BibAbbrv* info) const;
 	void Write(ostream& os, const BibComment* info) const;
 	void Write(ostream& os, const BibPreamble* info) const;
-	void Write(ostream& os, const BibEntry* info) const;
 };
 
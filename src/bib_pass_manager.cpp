@@ -0,0 +1,176 @@
+#include "bib_pass_manager.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#if defined _WIN32 || defined __CYGWIN__
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+using namespace string_utilities;
+
+static bool Intersects(const vector<string>& a, const vector<string>& b)
+{
+	if (a.empty() || b.empty()) return false;
+	if (count(a.begin(), a.end(), "*") || count(b.begin(), b.end(), "*")) return true;
+
+	for (auto& s : a)
+		if (count(b.begin(), b.end(), s))
+			return true;
+	return false;
+}
+
+bool BibPass::Conflicts(const BibPass* other) const
+{
+	if (scope == global || other->scope == global) return true;
+
+	// passes touching only their own entry can always be fused; a pass reading
+	// crossref'ed entries must not overlap with writers of the same fields
+	if (crossref && Intersects(reads, other->writes)) return true;
+	if (other->crossref && Intersects(other->reads, writes)) return true;
+	return false;
+}
+
+BibPassManager::~BibPassManager()
+{
+	// the code of plugin passes lives in the shared objects
+	passes.clear();
+
+	for (auto handle : plugins)
+	{
+#if defined _WIN32 || defined __CYGWIN__
+		FreeLibrary((HMODULE)handle);
+#else
+		dlclose(handle);
+#endif
+	}
+}
+
+void BibPassManager::AddEntryPass(const string& name, const vector<string>& reads, const vector<string>& writes, bool crossref, function<void(BibEntry*)> func)
+{
+	unique_ptr<BibPass> pass(new BibPass());
+	pass->name = name;
+	pass->scope = BibPass::entry;
+	pass->reads = reads;
+	pass->writes = writes;
+	pass->crossref = crossref;
+	pass->entryFunc = func;
+	passes.push_back(move(pass));
+}
+
+void BibPassManager::AddGlobalPass(const string& name, function<void(BibDatabase&)> func)
+{
+	unique_ptr<BibPass> pass(new BibPass());
+	pass->name = name;
+	pass->scope = BibPass::global;
+	pass->crossref = true;
+	pass->globalFunc = func;
+	passes.push_back(move(pass));
+}
+
+void BibPassManager::LoadPlugin(const string& filename)
+{
+#if defined _WIN32 || defined __CYGWIN__
+	HMODULE handle = LoadLibraryA(filename.c_str());
+	Logger::Error(handle != nullptr, "can't load plugin '" + filename + "'");
+	auto func = (RegisterPassesFunc)GetProcAddress(handle, BTSTYLE_PLUGIN_ENTRY);
+#else
+	void* handle = dlopen(filename.c_str(), RTLD_NOW);
+	if (handle == nullptr)
+		Logger::Error("can't load plugin '" + filename + "': " + string(dlerror()));
+	auto func = (RegisterPassesFunc)dlsym(handle, BTSTYLE_PLUGIN_ENTRY);
+#endif
+	plugins.push_back((void*)handle);
+	Logger::Error(func != nullptr, "plugin '" + filename + "' does not export " + BTSTYLE_PLUGIN_ENTRY);
+
+	size_t before = passes.size();
+	func(*this);
+	Logger::Debug("loaded " + to_string(passes.size() - before) + " passes from plugin '" + filename + "'");
+}
+
+vector<vector<const BibPass*> > BibPassManager::Schedule() const
+{
+	vector<vector<const BibPass*> > stages;
+	for (auto& pass : passes)
+	{
+		bool fused = false;
+		if (!stages.empty() && pass->scope == BibPass::entry && stages.back()[0]->scope == BibPass::entry)
+		{
+			fused = true;
+			for (auto p : stages.back())
+				fused &= !p->Conflicts(pass.get());
+		}
+
+		if (fused)
+			stages.back().push_back(pass.get());
+		else
+			stages.push_back(vector<const BibPass*>(1, pass.get()));
+	}
+
+	return stages;
+}
+
+void BibPassManager::Run(BibDatabase& db) const
+{
+	for (auto& stage : Schedule())
+	{
+		assert(!stage.empty());
+		if (stage[0]->scope == BibPass::global)
+		{
+			Logger::Debug("running pass " + stage[0]->name);
+			stage[0]->globalFunc(db);
+		}
+		else
+		{
+			string names;
+			for (auto p : stage)
+				names += (names != "" ? ", " : "") + p->name;
+			Logger::Debug("running fused passes " + names);
+			RunFused(stage, db);
+		}
+	}
+}
+
+void BibPassManager::RunFused(const vector<const BibPass*>& stage, BibDatabase& db) const
+{
+	// passes within a stage touch only their own entry, so entries are independent;
+	// exceptions must not leave the parallel loop, so failures are reported after it
+	int n = (int)db.entries.size();
+	vector<char> failed(n, 0);
+	vector<string> messages(n);
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int i = 0; i < n; i++)
+	{
+		try
+		{
+			for (auto p : stage)
+				p->entryFunc(db.entries[i]);
+		}
+		catch (int)
+		{
+			// the message is already logged by Logger::Error
+			failed[i] = 1;
+		}
+		catch (const exception& e)
+		{
+			failed[i] = 1;
+			messages[i] = (e.what() != nullptr && e.what()[0] != '\0' ? e.what() : "unknown error");
+		}
+		catch (...)
+		{
+			failed[i] = 1;
+			messages[i] = "unknown exception";
+		}
+	}
+
+	// the key of the first failed entry is always reported
+	for (int i = 0; i < n; i++)
+		if (failed[i])
+			Logger::Error("entry pass failed in " + db.entries[i]->getKey() + (messages[i] != "" ? ": " + messages[i] : ""));
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <memory>
+
+#include "bib_database.h"
+
+using namespace std;
+
+class BibPass
+{
+public:
+	enum SCOPE {entry = 0, global = 1};
+
+	string name;
+	SCOPE scope;
+
+	// field tags the pass reads and writes; "*" stands for all fields
+	vector<string> reads;
+	vector<string> writes;
+	// whether the pass reads fields of other (crossref'ed) entries
+	bool crossref;
+
+	function<void(BibEntry*)> entryFunc;
+	function<void(BibDatabase&)> globalFunc;
+
+	bool Conflicts(const BibPass* other) const;
+};
+
+// Entry point a shared-object plugin has to export (with C linkage)
+typedef void (*RegisterPassesFunc)(class BibPassManager& manager);
+#define BTSTYLE_PLUGIN_ENTRY "RegisterPasses"
+
+class BibPassManager
+{
+	vector<unique_ptr<BibPass> > passes;
+	vector<void*> plugins;
+
+private:
+	BibPassManager(const BibPassManager&);
+	BibPassManager& operator = (const BibPassManager&);
+	BibPassManager() {}
+
+	vector<vector<const BibPass*> > Schedule() const;
+	void RunFused(const vector<const BibPass*>& stage, BibDatabase& db) const;
+
+public:
+	static unique_ptr<BibPassManager> Create()
+	{
+		return unique_ptr<BibPassManager>(new BibPassManager());
+	}
+
+	~BibPassManager();
+
+	void AddEntryPass(const string& name, const vector<string>& reads, const vector<string>& writes, bool crossref, function<void(BibEntry*)> func);
+	void AddGlobalPass(const string& name, function<void(BibDatabase&)> func);
+	void LoadPlugin(const string& filename);
+
+	void Run(BibDatabase& db) const;
+};
@@ -0,0 +1,287 @@
+#include "bib_sort.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+#include "unicode_latex.h"
+
+#include <algorithm>
+#include <cctype>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace string_utilities;
+
+// bytes 0x00 and 0x01 are escaped, so that 0x00 terminates the component
+static void AppendEscaped(string& res, const string& s)
+{
+	for (char c : s)
+	{
+		unsigned char ch = c;
+		if (ch <= 0x01)
+		{
+			res += '\x01';
+			res += char(ch + 1);
+		}
+		else
+			res += c;
+	}
+	res += '\x00';
+}
+
+// the first number in the value, as a fixed-width big-endian integer
+static bool AppendNumeric(string& res, const string& s)
+{
+	size_t i = 0;
+	while (i < s.length() && !isdigit((unsigned char)s[i]))
+		i++;
+	if (i == s.length()) return false;
+
+	unsigned long long value = 0;
+	for (; i < s.length() && isdigit((unsigned char)s[i]); i++)
+		value = min(value * 10 + (s[i] - '0'), 999999999999999999ULL);
+
+	for (int shift = 56; shift >= 0; shift -= 8)
+		res += char((value >> shift) & 0xFF);
+	return true;
+}
+
+// digit runs are compared by their numeric value and precede letters; punctuation separates
+// the runs, so 1.9 precedes 1.10 and the pages 12--15 precede 115
+static void AppendNatural(string& res, const string& s)
+{
+	size_t i = 0, n = s.length();
+	while (i < n)
+	{
+		if (isdigit((unsigned char)s[i]))
+		{
+			size_t j = i;
+			while (j < n && isdigit((unsigned char)s[j]))
+				j++;
+			while (i + 1 < j && s[i] == '0')
+				i++;
+
+			res += '\x02';
+			res += char(min(j - i, size_t(255)));
+			res.append(s, i, j - i);
+			i = j;
+		}
+		else
+		{
+			unsigned char ch = tolower((unsigned char)s[i++]);
+			if (ch > 0x02)
+				res += char(ch);
+		}
+	}
+	res += '\x00';
+}
+
+void BibSortSpec::Compile(const string& spec)
+{
+	// the single-style values keep their former tie-breaks
+	string s = spec;
+	if (s == "title") s = "title,year,author";
+	else if (s == "year-asc") s = "year,author";
+	else if (s == "year-desc") s = "year-desc,author";
+
+	keys.clear();
+	for (auto& token : split(s, ","))
+	{
+		SortKey key;
+		string name = to_lower(trim(token));
+
+		string comparison;
+		size_t colon = name.find(':');
+		if (colon != string::npos)
+		{
+			comparison = name.substr(colon + 1);
+			name = name.substr(0, colon);
+		}
+
+		key.descending = false;
+		if (name.length() > 4 && name.substr(name.length() - 4) == "-asc")
+		{
+			name = name.substr(0, name.length() - 4);
+		}
+		else if (name.length() > 5 && name.substr(name.length() - 5) == "-desc")
+		{
+			name = name.substr(0, name.length() - 5);
+			key.descending = true;
+		}
+
+		Logger::Error(name != "", "invalid sort specification '" + spec + "'");
+		key.field = name;
+
+		if (comparison == "")
+		{
+			if (name == "year") key.comparison = numeric;
+			else if (name == "type" || name == "key") key.comparison = raw;
+			else key.comparison = collate;
+		}
+		else if (comparison == "raw") key.comparison = raw;
+		else if (comparison == "collate") key.comparison = collate;
+		else if (comparison == "num") key.comparison = numeric;
+		else if (comparison == "natural") key.comparison = natural;
+		else Logger::Error("invalid comparison '" + comparison + "' in sort specification '" + spec + "'");
+
+		keys.push_back(key);
+	}
+
+	Logger::Error(!keys.empty(), "invalid sort specification '" + spec + "'");
+}
+
+string BibSortSpec::FieldValue(const BibEntry* entry, const string& field) const
+{
+	if (field == "type") return entry->type;
+	if (field == "key") return entry->key;
+	if (field == "year") return entry->getYear();
+
+	return entry->getExpandedField(field);
+}
+
+void BibSortSpec::AppendKey(string& res, const BibEntry* entry, const SortKey& key) const
+{
+	string component;
+	bool present;
+	if (key.field == "author" && key.comparison == collate)
+	{
+		// last names separated by '\x01', so a shorter author list with the same prefix goes first
+		present = !entry->getAuthorKey().empty();
+		AppendEscaped(component, entry->getAuthorKey());
+	}
+	else if (key.field == "title" && key.comparison == collate)
+	{
+		present = entry->fields.count("title") > 0;
+		AppendEscaped(component, entry->getTitleKey());
+	}
+	else
+	{
+		string value = FieldValue(entry, key.field);
+		present = (value != "");
+		if (key.comparison == raw)
+			AppendEscaped(component, value);
+		else if (key.comparison == collate)
+			AppendEscaped(component, unicode_latex::collationKey(value));
+		else if (key.comparison == natural)
+			AppendNatural(component, unicode_latex::collationKey(value, true));
+		else
+			present &= AppendNumeric(component, value);
+	}
+
+	// entries without the value go last in either direction;
+	// numbers are padded to keep numeric keys fixed-width
+	if (!present)
+	{
+		res += '\x01';
+		if (key.comparison == numeric)
+			res.append(8, '\x00');
+		return;
+	}
+
+	res += '\x00';
+	if (key.descending)
+	{
+		for (auto& c : component)
+			c = ~c;
+	}
+	res += component;
+}
+
+string BibSortSpec::Key(const BibEntry* entry) const
+{
+	string res;
+	for (auto& key : keys)
+		AppendKey(res, entry, key);
+	return res;
+}
+
+vector<int> BibSortSpec::SortOrder(const vector<string>& keys)
+{
+	int n = (int)keys.size();
+	vector<int> order(n);
+	for (int i = 0; i < n; i++)
+		order[i] = i;
+	if (n <= 1) return order;
+
+	// fixed-width keys (years, numeric fields) are sorted by radix
+	size_t width = keys[0].length();
+	bool fixedWidth = (width <= 16);
+	for (int i = 1; i < n && fixedWidth; i++)
+		fixedWidth = (keys[i].length() == width);
+
+	if (fixedWidth)
+		RadixSort(keys, width, order);
+	else
+		MergeSort(keys, order);
+
+	return order;
+}
+
+void BibSortSpec::RadixSort(const vector<string>& keys, size_t width, vector<int>& order)
+{
+	// LSD: a stable counting sort per byte, starting from the last one
+	int n = (int)order.size();
+	vector<int> tmp(n);
+	for (size_t b = width; b-- > 0; )
+	{
+		vector<int> count(257, 0);
+		for (int i = 0; i < n; i++)
+			count[(unsigned char)keys[i][b] + 1]++;
+
+		// skipping the bytes shared by all the keys
+		if (*max_element(count.begin(), count.end()) == n) continue;
+
+		for (int c = 0; c < 256; c++)
+			count[c + 1] += count[c];
+		for (int i = 0; i < n; i++)
+			tmp[count[(unsigned char)keys[order[i]][b]]++] = order[i];
+		order.swap(tmp);
+	}
+}
+
+void BibSortSpec::MergeSort(const vector<string>& keys, vector<int>& order)
+{
+	// ties are broken by the original position, so the order is unique
+	auto less = [&](int i, int j)
+	{
+		int cmp = keys[i].compare(keys[j]);
+		return cmp < 0 || (cmp == 0 && i < j);
+	};
+
+	int n = (int)order.size();
+	int chunks = 1;
+#ifdef _OPENMP
+	if (n >= 65536)
+		chunks = omp_get_max_threads();
+#endif
+	if (chunks <= 1)
+	{
+		sort(order.begin(), order.end(), less);
+		return;
+	}
+
+	// sorting the chunks in parallel
+	vector<int> bounds(chunks + 1);
+	for (int c = 0; c <= chunks; c++)
+		bounds[c] = int((long long)n * c / chunks);
+
+	#pragma omp parallel for schedule(static, 1)
+	for (int c = 0; c < chunks; c++)
+		sort(order.begin() + bounds[c], order.begin() + bounds[c + 1], less);
+
+	// merging neighboring runs in parallel rounds
+	vector<int> tmp(n);
+	for (int step = 1; step < chunks; step *= 2)
+	{
+		#pragma omp parallel for schedule(static, 1)
+		for (int c = 0; c < chunks; c += 2 * step)
+		{
+			int lo = bounds[c];
+			int mid = bounds[min(c + step, chunks)];
+			int hi = bounds[min(c + 2 * step, chunks)];
+			merge(order.begin() + lo, order.begin() + mid, order.begin() + mid, order.begin() + hi, tmp.begin() + lo, less);
+		}
+		order.swap(tmp);
+	}
+}
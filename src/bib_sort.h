@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+// A compiled sort specification such as "type,journal,year-desc,pages:num,author".
+// Every entry is encoded into a single key, so that entries are ordered by
+// byte-wise comparison of the keys.
+class BibSortSpec
+{
+public:
+	enum COMPARISON {raw = 0, collate = 1, numeric = 2, natural = 3};
+
+private:
+	struct SortKey
+	{
+		string field;
+		bool descending;
+		COMPARISON comparison;
+	};
+
+	vector<SortKey> keys;
+
+private:
+	BibSortSpec(const BibSortSpec&);
+	BibSortSpec& operator = (const BibSortSpec&);
+	BibSortSpec() {}
+
+	void Compile(const string& spec);
+	string FieldValue(const BibEntry* entry, const string& field) const;
+	void AppendKey(string& res, const BibEntry* entry, const SortKey& key) const;
+
+	static void RadixSort(const vector<string>& keys, size_t width, vector<int>& order);
+	static void MergeSort(const vector<string>& keys, vector<int>& order);
+
+public:
+	static unique_ptr<BibSortSpec> Create(const string& spec)
+	{
+		auto res = unique_ptr<BibSortSpec>(new BibSortSpec());
+		res->Compile(spec);
+		return res;
+	}
+
+	string Key(const BibEntry* entry) const;
+
+	// stable order of the keys; deterministic for any number of threads
+	static vector<int> SortOrder(const vector<string>& keys);
+};
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <set>
 
 #include "bib_entry.h"
 #include "dblp/sqlite3.h"
@@ -32,6 +33,7 @@ private:
 	vector<DBLPEntry> findByTitle(const string& title) const;
 	DBLPEntry findByKey(const string& key) const;
 	unique_ptr<BibEntry> CreateBibEntry(const DBLPEntry& dblpEntry, const BibParser& parser) const;
+	unique_ptr<BibEntry> CreateBibEntry(const DBLPEntry& dblpEntry, const BibParser& parser, set<string>& chain) const;
 	BibEntry* FilterDBLPEntries(vector<BibEntry*> entries, BibEntry* entry) const;
 	void FilterDBLPEntriesByAuthor(vector<BibEntry*>& entries, BibEntry* entry) const;
 	void FilterDBLPEntriesByYear(vector<BibEntry*>& entries, BibEntry* entry) const;
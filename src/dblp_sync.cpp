@@ -2,6 +2,7 @@
 #include "bib_parser.h"
 #include "dblp_database.h"
 #include "string_utilities.h"
+#include "unicode_latex.h"
 
 #include "logger.h"
 #include <fstream>
@@ -162,7 +163,7 @@ void DBLPDatabase::FilterDBLPEntriesByAuthor(vector<BibEntry*>& entries, BibEntr
 				return true;
 
 			for (int i = 0; i < (int)authors.size(); i++)
-				if (to_alpha(to_lower(authors[i].last)) != to_alpha(to_lower(authors2[i].last)))
+				if (to_alpha(unicode_latex::collationKey(authors[i].last)) != to_alpha(unicode_latex::collationKey(authors2[i].last)))
 					return true;
 
 			return false;
@@ -202,6 +203,12 @@ void DBLPDatabase::FilterDBLPEntriesByType(vector<BibEntry*>& entries, BibEntry*
 }
 
 unique_ptr<BibEntry> DBLPDatabase::CreateBibEntry(const DBLPEntry& dblpEntry, const BibParser& parser) const
+{
+	set<string> chain;
+	return CreateBibEntry(dblpEntry, parser, chain);
+}
+
+unique_ptr<BibEntry> DBLPDatabase::CreateBibEntry(const DBLPEntry& dblpEntry, const BibParser& parser, set<string>& chain) const
 {
 	try
 	{
@@ -209,6 +216,12 @@ unique_ptr<BibEntry> DBLPDatabase::CreateBibEntry(const DBLPEntry& dblpEntry, co
 		if (entry->fields.count("crossref"))
 		{
 			string ref = unquote(entry->fields["crossref"]);
+			if (!chain.insert(to_lower(ref)).second)
+			{
+				Logger::Warning("crossref cycle in dblp database at '" + ref + "'");
+				return entry;
+			}
+
 			DBLPEntry dblpEntry;
 			try 
 			{
@@ -221,7 +234,7 @@ unique_ptr<BibEntry> DBLPDatabase::CreateBibEntry(const DBLPEntry& dblpEntry, co
 				return entry;
 			}
 
-			auto bibDBLPEntry = unique_ptr<BibEntry>(CreateBibEntry(dblpEntry, parser));
+			auto bibDBLPEntry = unique_ptr<BibEntry>(CreateBibEntry(dblpEntry, parser, chain));
 
 			// syncing from referenced entry
 			for (auto f : bibDBLPEntry->fields)
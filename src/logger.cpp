@@ -27,11 +27,14 @@ void Logger::Error(bool condition, const string& msg)
 
 void Logger::Error(const string& msg)
 {
-	SetColor(12);
-	cerr << "Error: " << flush;
+	#pragma omp critical(logger)
+	{
+		SetColor(12);
+		cerr << "Error: " << flush;
 
-	SetColor(7);
-	cerr << msg << endl;
+		SetColor(7);
+		cerr << msg << endl;
+	}
 
 	throw 1;
 }
@@ -46,14 +49,17 @@ void Logger::Warning(const string& msg)
 {
 	if (logLevel > warning) return;
 
-	warningCount++;
+	#pragma omp critical(logger)
+	{
+		warningCount++;
 
-	//SetColor(9);
-	SetColor(13);
-	cerr << "Warning: "<< flush;
+		//SetColor(9);
+		SetColor(13);
+		cerr << "Warning: "<< flush;
 
-	SetColor(7);
-	cerr << msg << endl;
+		SetColor(7);
+		cerr << msg << endl;
+	}
 }
 
 void Logger::Debug(bool condition, const string& msg)
@@ -66,17 +72,21 @@ void Logger::Debug(const string& msg)
 {
 	if (logLevel > debug) return;
 
-	SetColor(8);
-	cerr << "Debug: "<< flush;
+	#pragma omp critical(logger)
+	{
+		SetColor(8);
+		cerr << "Debug: "<< flush;
 
-	SetColor(7);
-	cerr << msg << endl;
+		SetColor(7);
+		cerr << msg << endl;
+	}
 }
 
 void Logger::Info(const string& msg)
 {
 	if (logLevel > info) return;
 
+	#pragma omp critical(logger)
 	cerr << msg << endl;
 }
 
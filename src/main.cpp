@@ -1,6 +1,16 @@
 #include "bib_parser.h"
+#include "bib_pass_manager.h"
+#include "bib_external_sort.h"
+#include "bib_merge.h"
 #include "cmd_options.h"
+#include "tex_project.h"
 #include "logger.h"
+#include "string_utilities.h"
+
+#include <fstream>
+#include <cstdlib>
+
+using namespace string_utilities;
 
 void PrepareCMDOptions(int argc, char** argv, CMDOptions& args)
 {
@@ -12,27 +22,49 @@ void PrepareCMDOptions(int argc, char** argv, CMDOptions& args)
 
 	args.AddAllowedOption("", "", "Input file name");
 
+	args.AddAllowedOption("--only-cited", "", "Keep only the entries (and their crossref targets) cited in the specified .aux or TeX files or directories (comma-separated)");
+
+	args.AddAllowedOption("--lint", "", "Check the entries with the specified rules (comma-separated) or all of them; by default only the required fields are checked");
+
+	args.AddAllowedOption("--lint-report", "", "Write the issues found by the checks to the specified file as tab-separated key, rule, field and message");
+
 	args.AddAllowedOption("--field-delimeters", "", "Convert outer delimeters in field values to either braces or double quotes");
 	args.AddAllowedValue("--field-delimeters", "braces");
 	args.AddAllowedValue("--field-delimeters", "quotes");
 
 	args.AddAllowedOption("--replace-unicode", "Replace special UTF-8 symbols with the corresponding LaTeX command");
 
+	args.AddAllowedOption("--latex-to-unicode", "Replace LaTeX accent and symbol commands with the corresponding UTF-8 symbols");
+
 	args.AddAllowedOption("--fix-pages", "Replace single dash with double one in pages");
 
 	args.AddAllowedOption("--fix-padding", "Remove line breaks and adjust white spaces in field values");
 
-	args.AddAllowedOption("--keys", "", "Modify entry keys according to the specified style");
-	args.AddAllowedValue("--keys", "alpha");
-	args.AddAllowedValue("--keys", "abstract");
+	args.AddAllowedOption("--report-duplicates", "Report groups of identical entries (same type, title, authors and year)");
+
+	args.AddAllowedOption("--collapse-duplicates", "Keep only the first of identical entries; citations of the removed keys are rewritten with --keys-tex");
+
+	args.AddAllowedOption("--near-duplicates", "", "Report clusters of entries with similar titles (estimated Jaccard similarity of title shingles at least the specified value, e.g. 0.8) and matching authors and year");
+
+	args.AddAllowedOption("--flatten-crossref", "Copy the inherited fields into the entries and remove crossref fields");
+
+	args.AddAllowedOption("--factor-crossref", "Move venue fields shared by several @inproceedings entries into new @proceedings entries referenced via crossref");
+
+	args.AddAllowedOption("--factor-strings", "", "Replace venue field values repeated at least the specified number of times with new @string abbreviations");
 
-	args.AddAllowedOption("--keys-tex", "", "If --keys option is specified, then all the Bib entries are modified in the provided TeX file");
+	args.AddAllowedOption("--keys", "", "Modify entry keys according to the specified style (alpha, abstract) or template such as {auth.last:lower}{year}{title.word1:lower}");
 
-	args.AddAllowedOption("--sort", "", "Sort entries according to the specified style");
-	args.AddAllowedValue("--sort", "author");
-	args.AddAllowedValue("--sort", "title");
-	args.AddAllowedValue("--sort", "year-asc");
-	args.AddAllowedValue("--sort", "year-desc");
+	args.AddAllowedOption("--rename-keys", "", "Rename entry keys, crossrefs and citations in the --keys-tex files according to the specified file of old and new keys (one pair per line)");
+
+	args.AddAllowedOption("--keys-tex", "", "If --keys or --rename-keys option is specified, then all the Bib entries are modified in the provided TeX files (comma-separated) and the files they include, or in all TeX files of the provided directories");
+
+	args.AddAllowedOption("--keys-registry", "", "If --keys option is specified, keep the keys of entries recorded in the specified file and record the keys of new entries");
+
+	args.AddAllowedOption("--sort", "", "Sort entries according to the specified style (author, title, year-asc, year-desc) or by a comma-separated list of keys field[-asc|-desc][:raw|collate|num|natural]");
+
+	args.AddAllowedOption("--memory-limit", "", "If --sort option is specified and the parsed input exceeds the limit (in MB), sort in runs using temporary files; crossrefs are resolved within a run only");
+
+	args.AddAllowedOption("--merge", "", "Merge the specified bib files (comma-separated), each sorted according to --sort, and write the result to stdout");
 
 	args.AddAllowedOption("--format-author", "", "Format author names to either space-separated (First Last) or comma-separated (Last, First) format");
 	args.AddAllowedValue("--format-author", "space");
@@ -40,6 +72,8 @@ void PrepareCMDOptions(int argc, char** argv, CMDOptions& args)
 
 	args.AddAllowedOption("--sync-dblp", "", "Synchronize entries with the specified dblp database");
 
+	args.AddAllowedOption("--plugin", "", "Load additional passes from the specified shared objects (comma-separated)");
+
 	args.AddAllowedOption("--log-level", "info", "Log level");
 	args.AddAllowedValue("--log-level", "debug");
 	args.AddAllowedValue("--log-level", "info");
@@ -62,44 +96,228 @@ void PrepareCMDOptions(int argc, char** argv, CMDOptions& args)
 	}
 } 
 
-void ProcessBibInfo(const CMDOptions& options, BibDatabase& db)
+void RegisterPasses(const CMDOptions& options, BibDatabase& db, BibPassManager& passes, bool streaming)
 {
-	db.InitKeyEntryMap();
-	db.InitRefEntries();
-	db.CheckRequiredFields();
+	auto allFields = vector_of_strings("*")();
+
+	// filtering goes first, so that the other passes process the cited entries only
+	string citedFiles = options.getOption("--only-cited");
+	if (citedFiles != "")
+	{
+		auto cited = make_shared<unordered_set<string> >(TexProject::Create(citedFiles)->CitedKeys());
+		Logger::Debug("found " + to_string(cited->size()) + " cited keys");
+		passes.AddGlobalPass("only-cited", [=](BibDatabase& db) { db.FilterCited(*cited, !streaming); });
+	}
+
+	// crossref'ed entries may be in other chunks when streaming
+	string lintRules = options.getOption("--lint");
+	string lintReport = options.getOption("--lint-report");
+	Logger::Error(!streaming || (lintRules == "" && lintReport == ""), "options --lint and --lint-report cannot be combined with sorting in runs");
+	if (!streaming)
+	{
+		shared_ptr<BibLinter> linter = BibLinter::Create(lintRules);
+		passes.AddGlobalPass("lint", [=](BibDatabase& db) { db.Lint(*linter, lintReport); });
+	}
 
 	string dblpDBFile = options.getOption("--sync-dblp");
 	if (dblpDBFile != "")
-		db.SyncDBLP(dblpDBFile);
+		passes.AddGlobalPass("sync-dblp", [=](BibDatabase& db) { db.SyncDBLP(dblpDBFile); });
 
 	string fieldDelimeters = options.getOption("--field-delimeters");
 	if (fieldDelimeters != "")
-		db.ConvertFieldDelimeters(fieldDelimeters);
+		passes.AddEntryPass("field-delimeters", allFields, allFields, false, 
+			[&db, fieldDelimeters](BibEntry* e) { db.ConvertFieldDelimeters(e, fieldDelimeters); });
+
+	if (options.hasOption("--latex-to-unicode"))
+		passes.AddEntryPass("latex-to-unicode", allFields, allFields, false, 
+			[&](BibEntry* e) { db.ReplaceLatexCommands(e); });
 
 	if (options.hasOption("--replace-unicode"))
-		db.ReplaceUnicodeCharacters();
+		passes.AddEntryPass("replace-unicode", allFields, allFields, false, 
+			[&](BibEntry* e) { db.ReplaceUnicodeCharacters(e); });
 
 	if (options.hasOption("--fix-pages"))
-		db.FixPagesDash();
+		passes.AddEntryPass("fix-pages", vector_of_strings("pages")(), vector_of_strings("pages")(), false, 
+			[&](BibEntry* e) { db.FixPagesDash(e); });
 
 	if (options.hasOption("--fix-padding"))
-		db.FixPadding();
+	{
+		auto fields = vector_of_strings("title")("journal")("booktitle")("publisher")("series")("address")("organization")("institution")("howpublished")();
+		passes.AddEntryPass("fix-padding", fields, fields, false, 
+			[&](BibEntry* e) { db.FixPadding(e); });
+	}
 
 	string authorFormat = options.getOption("--format-author");
 	if (authorFormat != "")
-		db.FormatAuthor(authorFormat);
+		passes.AddEntryPass("format-author", vector_of_strings("author")(), vector_of_strings("author")(), false, 
+			[&db, authorFormat](BibEntry* e) { db.FormatAuthor(e, authorFormat); });
+
+	// plugin passes are fused with the built-in per-entry ones
+	string plugins = options.getOption("--plugin");
+	for (auto& plugin : split(plugins, ","))
+		passes.LoadPlugin(plugin);
+
+	// string abbreviations are converted after the per-entry passes, which stay fused
+	if (options.hasOption("--latex-to-unicode"))
+		passes.AddGlobalPass("latex-to-unicode-strings", [](BibDatabase& db) { db.ReplaceLatexInAbbreviations(); });
+	if (options.hasOption("--replace-unicode"))
+		passes.AddGlobalPass("replace-unicode-strings", [](BibDatabase& db) { db.ReplaceUnicodeInAbbreviations(); });
+
+	vector<string> texFiles;
+	string texFile = options.getOption("--keys-tex");
+	if (texFile != "")
+		texFiles = TexProject::Create(texFile)->getFiles();
+
+	bool collapse = options.hasOption("--collapse-duplicates");
+	if (options.hasOption("--report-duplicates") || collapse)
+	{
+		Logger::Error(!streaming, "duplicate detection cannot be combined with sorting in runs");
+		passes.AddGlobalPass("find-duplicates", [=](BibDatabase& db) { db.FindDuplicates(collapse, texFiles); });
+	}
+
+	string similarity = options.getOption("--near-duplicates");
+	if (similarity != "")
+	{
+		Logger::Error(!streaming, "option --near-duplicates cannot be combined with sorting in runs");
+		double threshold = atof(similarity.c_str());
+		Logger::Error(threshold > 0 && threshold <= 1, "invalid similarity threshold '" + similarity + "'");
+		passes.AddGlobalPass("near-duplicates", [=](BibDatabase& db) { db.FindNearDuplicates(threshold); });
+	}
+
+	bool flatten = options.hasOption("--flatten-crossref");
+	bool factor = options.hasOption("--factor-crossref");
+	if (flatten || factor)
+	{
+		Logger::Error(!streaming, "crossref transformations cannot be combined with sorting in runs");
+		Logger::Error(!flatten || !factor, "options --flatten-crossref and --factor-crossref are exclusive");
+		if (flatten)
+			passes.AddGlobalPass("flatten-crossref", [](BibDatabase& db) { db.FlattenCrossrefs(); });
+		else
+			passes.AddGlobalPass("factor-crossref", [](BibDatabase& db) { db.FactorCrossrefs(); });
+	}
+
+	string repeats = options.getOption("--factor-strings");
+	if (repeats != "")
+	{
+		Logger::Error(!streaming, "option --factor-strings cannot be combined with sorting in runs");
+		Logger::Error(isInteger(repeats) && atoi(repeats.c_str()) >= 2, "invalid number of repetitions '" + repeats + "'");
+		int minCount = atoi(repeats.c_str());
+		passes.AddGlobalPass("factor-strings", [=](BibDatabase& db) { db.FactorStrings(minCount); });
+	}
 
 	string keys = options.getOption("--keys");
+	string renameFile = options.getOption("--rename-keys");
+	if (renameFile != "")
+	{
+		Logger::Error(!streaming, "option --rename-keys cannot be combined with sorting in runs");
+		Logger::Error(keys == "", "option --rename-keys cannot be combined with --keys");
+		passes.AddGlobalPass("rename-keys", [=](BibDatabase& db) { db.RenameKeys(renameFile, texFiles); });
+	}
+
 	if (keys != "")
-		db.ConvertKeys(keys, options.getOption("--keys-tex"));
+	{
+		Logger::Error(!streaming, "option --keys cannot be combined with sorting in runs");
+		shared_ptr<BibKeyTemplate> keyTemplate = BibKeyTemplate::Create(keys);
+		string registryFile = options.getOption("--keys-registry");
+		passes.AddGlobalPass("convert-keys", [=](BibDatabase& db) 
+		{
+			if (registryFile == "")
+			{
+				db.ConvertKeys(*keyTemplate, nullptr, texFiles);
+				return;
+			}
+
+			auto registry = BibKeyRegistry::Create(registryFile);
+			db.ConvertKeys(*keyTemplate, registry.get(), texFiles);
+			registry->Save();
+		});
+	}
 
 	string sort = options.getOption("--sort");
-	if (sort != "")
-		db.SortEntries(sort);
+	if (sort != "" && !streaming)
+	{
+		shared_ptr<BibSortSpec> spec = BibSortSpec::Create(sort);
+		passes.AddGlobalPass("sort", [=](BibDatabase& db) { db.SortEntries(*spec); });
+	}
+}
+
+void ProcessBibInfo(const CMDOptions& options, BibDatabase& db)
+{
+	db.InitKeyEntryMap();
+	db.InitRefEntries(false);
+
+	auto passes = BibPassManager::Create();
+	RegisterPasses(options, db, *passes, false);
+	passes->Run(db);
+
+	db.LogDetails();
+}
+
+long long MemoryLimit(const CMDOptions& options)
+{
+	string limit = options.getOption("--memory-limit");
+	if (limit == "" || options.getOption("--sort") == "") return -1;
+
+	Logger::Error(isInteger(limit) && stoll(limit) > 0, "invalid memory limit '" + limit + "'");
+	long long bytes = stoll(limit) * 1024 * 1024;
+
+	// the size of stdin is unknown; parsed entries take about seven times the size of their text
+	const int PARSED_SIZE_RATIO = 7;
+	string filename = options.getOption("");
+	if (filename != "")
+	{
+		ifstream is(filename.c_str(), ios::in | ios::binary | ios::ate);
+		if (is && (long long)is.tellg() * PARSED_SIZE_RATIO <= bytes) return -1;
+	}
+
+	return bytes;
+}
+
+void ProcessBibStream(const CMDOptions& options, const BibParser& parser, BibDatabase& db, long long memoryLimit)
+{
+	auto spec = BibSortSpec::Create(options.getOption("--sort"));
+	auto sorter = BibExternalSort::Create(parser, *spec, memoryLimit);
+
+	auto passes = BibPassManager::Create();
+	RegisterPasses(options, db, *passes, true);
+
+	// every chunk of the input is processed and spilled as a sorted run;
+	// crossrefs are resolved within the chunk
+	auto processChunk = [&]()
+	{
+		db.InitKeyEntryMap();
+		db.InitRefEntries(true);
+		passes->Run(db);
+		sorter->AddRun(db);
+	};
+
+	parser.Read(options.getOption(""), db, [&](long long)
+	{
+		if (sorter->IsFull(db))
+			processChunk();
+	});
+	processChunk();
+
+	parser.Write(options.getOption(""), [&](ostream& os) 
+	{
+		parser.WriteHead(os, db);
+		sorter->Merge(os);
+		parser.WriteTail(os, db);
+	});
 
 	db.LogDetails();
 }
 
+void MergeBibFiles(const CMDOptions& options, const BibParser& parser)
+{
+	string sort = options.getOption("--sort");
+	Logger::Error(sort != "", "option --merge requires --sort");
+
+	auto spec = BibSortSpec::Create(sort);
+	auto merge = BibMerge::Create(parser, *spec);
+	parser.Write("", [&](ostream& os) { merge->Merge(split(options.getOption("--merge"), ","), os); });
+}
+
 int main(int argc, char** argv)
 {
 	auto options = CMDOptions::Create();
@@ -112,18 +330,28 @@ int main(int argc, char** argv)
 		PrepareCMDOptions(argc, argv, *options);
 		Logger::SetLogLevel(options->getOption("--log-level"));
 
-		parser->Read(options->getOption(""), *db);
-
-		ProcessBibInfo(*options, *db);
-
-		parser->Write(options->getOption(""), *db);
+		long long memoryLimit = MemoryLimit(*options);
+		if (options->getOption("--merge") != "")
+		{
+			MergeBibFiles(*options, *parser);
+		}
+		else if (memoryLimit > 0)
+		{
+			ProcessBibStream(*options, *parser, *db, memoryLimit);
+		}
+		else
+		{
+			parser->Read(options->getOption(""), *db);
+
+			ProcessBibInfo(*options, *db);
+
+			parser->Write(options->getOption(""), *db);
+		}
 	}
 	catch (int code)
 	{
 		returnCode = code;
 	}
 
-	// TODO: report identical entries
-
 	return returnCode;
 }
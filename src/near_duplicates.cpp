@@ -0,0 +1,212 @@
+#include "bib_database.h"
+#include "near_duplicates.h"
+#include "string_utilities.h"
+
+#include "logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+
+using namespace string_utilities;
+
+void BibDatabase::FindNearDuplicates(double threshold) const
+{
+	auto index = MinHashIndex::Create(threshold);
+	index->Build(entries);
+
+	auto clusters = index->Clusters();
+	for (auto& cluster : clusters)
+	{
+		string keys;
+		for (int i : cluster)
+			keys += (keys.empty() ? "" : ", ") + entries[i]->key;
+		Logger::Warning("similar entries " + keys);
+	}
+
+	Logger::Debug("found " + to_string(clusters.size()) + " clusters of similar entries");
+}
+
+
+namespace {
+
+unsigned long long mix(unsigned long long x)
+{
+	// splitmix64 finalizer
+	x ^= x >> 30;
+	x *= 0xBF58476D1CE4E5B9ULL;
+	x ^= x >> 27;
+	x *= 0x94D049BB133111EBULL;
+	x ^= x >> 31;
+	return x;
+}
+
+int findRoot(vector<int>& parent, int x)
+{
+	while (parent[x] != x)
+	{
+		parent[x] = parent[parent[x]];
+		x = parent[x];
+	}
+	return x;
+}
+
+vector<string> splitAuthors(const string& authorKey)
+{
+	vector<string> res;
+	size_t start = 0;
+	for (size_t i = 0; i < authorKey.length(); i++)
+		if (authorKey[i] == '\x01')
+		{
+			res.push_back(authorKey.substr(start, i - start));
+			start = i + 1;
+		}
+	return res;
+}
+
+};
+
+MinHashIndex::MinHashIndex(double threshold): threshold(threshold)
+{
+	// the LSH threshold (1/b)^(1/r) is the largest one below the requested similarity,
+	// so that pairs above it are missed with small probability
+	rows = 1;
+	for (int r = 2; r <= SIGNATURE_SIZE; r++)
+	{
+		int b = SIGNATURE_SIZE / r;
+		if (pow(1.0 / b, 1.0 / r) > threshold) break;
+		rows = r;
+	}
+	bands = SIGNATURE_SIZE / rows;
+}
+
+vector<unsigned long long> MinHashIndex::Signature(const string& title) const
+{
+	vector<unsigned long long> res(SIGNATURE_SIZE, ~0ULL);
+
+	// shingles are the character 3-grams of the title padded with spaces
+	string s = " " + title + " ";
+	for (int i = 0; i + SHINGLE_SIZE <= (int)s.length(); i++)
+	{
+		unsigned long long h = hash64(s.substr(i, SHINGLE_SIZE));
+		for (int k = 0; k < SIGNATURE_SIZE; k++)
+			res[k] = min(res[k], mix(h + 0x9E3779B97F4A7C15ULL * (k + 1)));
+	}
+
+	return res;
+}
+
+void MinHashIndex::Build(const vector<BibEntry*>& entries)
+{
+	int n = (int)entries.size();
+	this->entries.assign(entries.begin(), entries.end());
+	signatures.assign(n, vector<unsigned long long>());
+	authors.assign(n, vector<string>());
+	years.assign(n, "");
+
+	#pragma omp parallel for schedule(dynamic, 64)
+	for (int i = 0; i < n; i++)
+	{
+		const string& title = entries[i]->getTitleKey();
+		if (title != "")
+			signatures[i] = Signature(title);
+
+		authors[i] = splitAuthors(entries[i]->getAuthorKey());
+		sort(authors[i].begin(), authors[i].end());
+		years[i] = trim(entries[i]->getYear());
+	}
+}
+
+double MinHashIndex::Similarity(int i, int j) const
+{
+	int equal = 0;
+	for (int k = 0; k < SIGNATURE_SIZE; k++)
+		if (signatures[i][k] == signatures[j][k]) equal++;
+	return double(equal) / SIGNATURE_SIZE;
+}
+
+bool MinHashIndex::SameAuthors(int i, int j) const
+{
+	// at least half of the shorter author list is shared
+	const vector<string>& a1 = authors[i];
+	const vector<string>& a2 = authors[j];
+	if (a1.empty() || a2.empty()) return a1.empty() && a2.empty();
+
+	vector<string> common;
+	set_intersection(a1.begin(), a1.end(), a2.begin(), a2.end(), back_inserter(common));
+	return 2 * common.size() >= min(a1.size(), a2.size());
+}
+
+bool MinHashIndex::SameYear(int i, int j) const
+{
+	// preprints often precede the publication by a year
+	const string& y1 = years[i];
+	const string& y2 = years[j];
+	if (!isInteger(y1) || !isInteger(y2)) return y1 == y2;
+
+	return abs(stoi(y1) - stoi(y2)) <= 1;
+}
+
+vector<pair<int, int> > MinHashIndex::CandidatePairs() const
+{
+	int n = (int)entries.size();
+	vector<pair<int, int> > res;
+
+	vector<pair<unsigned long long, int> > buckets;
+	buckets.reserve(n);
+	for (int b = 0; b < bands; b++)
+	{
+		buckets.clear();
+		for (int i = 0; i < n; i++)
+		{
+			if (signatures[i].empty()) continue;
+
+			unsigned long long h = b;
+			for (int k = b * rows; k < (b + 1) * rows; k++)
+				h = mix(h ^ signatures[i][k]);
+			buckets.push_back(make_pair(h, i));
+		}
+		sort(buckets.begin(), buckets.end());
+
+		for (int i = 0; i < (int)buckets.size(); i++)
+			for (int j = i - 1; j >= 0 && j >= i - MAX_BUCKET_PAIRS && buckets[j].first == buckets[i].first; j--)
+				res.push_back(make_pair(buckets[j].second, buckets[i].second));
+	}
+
+	sort(res.begin(), res.end());
+	res.erase(unique(res.begin(), res.end()), res.end());
+	return res;
+}
+
+vector<vector<int> > MinHashIndex::Clusters() const
+{
+	auto pairs = CandidatePairs();
+	Logger::Debug("LSH with " + to_string(bands) + " bands of " + to_string(rows) + " rows produced " + to_string(pairs.size()) + " candidate pairs");
+
+	// candidates are verified in parallel, cheapest checks first, and joined with union-find
+	vector<char> verified(pairs.size());
+	#pragma omp parallel for schedule(dynamic, 256)
+	for (int p = 0; p < (int)pairs.size(); p++)
+	{
+		int i = pairs[p].first, j = pairs[p].second;
+		verified[p] = SameYear(i, j) && SameAuthors(i, j) && Similarity(i, j) >= threshold;
+	}
+
+	int n = (int)entries.size();
+	vector<int> parent(n);
+	for (int i = 0; i < n; i++)
+		parent[i] = i;
+	for (int p = 0; p < (int)pairs.size(); p++)
+		if (verified[p])
+			parent[findRoot(parent, pairs[p].second)] = findRoot(parent, pairs[p].first);
+
+	vector<vector<int> > groups(n);
+	for (int i = 0; i < n; i++)
+		groups[findRoot(parent, i)].push_back(i);
+
+	vector<vector<int> > res;
+	for (auto& group : groups)
+		if (group.size() > 1)
+			res.push_back(group);
+	return res;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "bib_entry.h"
+
+using namespace std;
+
+// MinHash signatures of title shingles with LSH banding; entries sharing a band
+// are the candidates for near-duplicates
+class MinHashIndex
+{
+	static const int SIGNATURE_SIZE = 64;
+	static const int SHINGLE_SIZE = 3;
+	// bucket members are compared with at most that many preceding ones
+	static const int MAX_BUCKET_PAIRS = 16;
+
+	double threshold;
+	int rows;
+	int bands;
+
+	vector<const BibEntry*> entries;
+	vector<vector<unsigned long long> > signatures;
+	vector<vector<string> > authors;
+	vector<string> years;
+
+private:
+	MinHashIndex(const MinHashIndex&);
+	MinHashIndex& operator = (const MinHashIndex&);
+	MinHashIndex(double threshold);
+
+	vector<unsigned long long> Signature(const string& title) const;
+	double Similarity(int i, int j) const;
+	bool SameAuthors(int i, int j) const;
+	bool SameYear(int i, int j) const;
+	vector<pair<int, int> > CandidatePairs() const;
+
+public:
+	static unique_ptr<MinHashIndex> Create(double threshold)
+	{
+		return unique_ptr<MinHashIndex>(new MinHashIndex(threshold));
+	}
+
+	void Build(const vector<BibEntry*>& entries);
+	vector<vector<int> > Clusters() const;
+};
@@ -109,6 +109,22 @@ bool isInteger(const string& s)
 	//return all_of(s.begin(), s.end(), ::isdigit);
 }
 
+bool isDigits(const string& s)
+{
+	return s != "" && s.find_first_not_of("0123456789") == string::npos;
+}
+
+bool isStopWord(const string& word)
+{
+	// English words skipped when taking the significant words of titles
+	static const char* STOP_WORDS[] = {"a", "an", "and", "at", "by", "for", "from", "in", "of", "on", "or", "the", "to", "with"};
+
+	string s = to_alpha(word);
+	for (auto w : STOP_WORDS)
+		if (s == w) return true;
+	return false;
+}
+
 string to_lower(const string& s)
 {
 	string res = s;
@@ -129,4 +145,16 @@ string to_alpha(const string& s)
 	return res;
 }
 
+unsigned long long hash64(const string& s)
+{
+	// FNV-1a
+	unsigned long long h = 14695981039346656037ULL;
+	for (char c : s)
+	{
+		h ^= (unsigned char)c;
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
 };
\ No newline at end of file
@@ -13,10 +13,13 @@ string trim(const string& line);
 string replace(const string& s, const string& search, const string& replace);
 vector<string> split(const string& s, const string& c); 
 bool isInteger(const string& s); 
+bool isDigits(const string& s);
+bool isStopWord(const string& word);
 string unquote(const string& s, string& openQ, string& closeQ); 
 string unquote(const string& s); 
 string to_lower(const string& s); 
 string to_alpha(const string& s);
+unsigned long long hash64(const string& s);
 
 template <typename T> 
 string to_string(const T& n)
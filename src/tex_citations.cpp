@@ -0,0 +1,176 @@
+#include "tex_citations.h"
+
+#include <cstring>
+#include <cctype>
+
+const char* tex_citations::COMMANDS[] = {"cite", "citep", "citet", "parencite", "textcite", "nocite", "autocite", nullptr};
+
+bool tex_citations::isCommand(const char* s, size_t n)
+{
+	for (int i = 0; COMMANDS[i] != nullptr; i++)
+		if (strlen(COMMANDS[i]) == n && memcmp(COMMANDS[i], s, n) == 0)
+			return true;
+	return false;
+}
+
+size_t tex_citations::skipSpaces(const char* s, size_t n, size_t i)
+{
+	while (i < n && isspace((unsigned char)s[i]))
+		i++;
+	return i;
+}
+
+size_t tex_citations::skipOptional(const char* s, size_t n, size_t i)
+{
+	// an optional argument [..] with balanced braces; returns i if there is none
+	if (i >= n || s[i] != '[') return i;
+
+	int depth = 0;
+	for (size_t j = i + 1; j < n; j++)
+	{
+		if (s[j] == '{') depth++;
+		else if (s[j] == '}') depth--;
+		else if (s[j] == ']' && depth == 0) return j + 1;
+
+		if (depth < 0) break;
+	}
+	return i;
+}
+
+vector<pair<size_t, size_t> > tex_citations::findKeyLists(const string& str)
+{
+	vector<pair<size_t, size_t> > res;
+	const char* s = str.data();
+	size_t n = str.length();
+
+	size_t i = 0;
+	while (i < n)
+	{
+		const char* p = (const char*)memchr(s + i, '\\', n - i);
+		if (p == nullptr) break;
+
+		size_t start = p - s + 1;
+		i = start;
+		while (i < n && isalpha((unsigned char)s[i]))
+			i++;
+		if (!isCommand(s + start, i - start)) continue;
+
+		if (i < n && s[i] == '*') i++;
+
+		// up to two optional arguments, e.g. \citep[see][p.~5]{key}
+		size_t j = skipSpaces(s, n, i);
+		for (int k = 0; k < 2; k++)
+		{
+			size_t next = skipOptional(s, n, j);
+			if (next == j) break;
+			j = skipSpaces(s, n, next);
+		}
+
+		if (j >= n || s[j] != '{') continue;
+
+		size_t close = j + 1;
+		while (close < n && s[close] != '}' && s[close] != '{')
+			close++;
+		if (close >= n || s[close] != '}') continue;
+
+		res.push_back(make_pair(j + 1, close));
+		i = close + 1;
+	}
+
+	return res;
+}
+
+vector<pair<size_t, size_t> > tex_citations::splitKeys(const string& s, size_t begin, size_t end)
+{
+	vector<pair<size_t, size_t> > res;
+	size_t i = begin;
+	while (i <= end)
+	{
+		size_t comma = s.find(',', i);
+		if (comma == string::npos || comma > end) comma = end;
+
+		size_t b = i, e = comma;
+		while (b < e && isspace((unsigned char)s[b]))
+			b++;
+		while (e > b && isspace((unsigned char)s[e - 1]))
+			e--;
+		if (b < e)
+			res.push_back(make_pair(b, e));
+
+		i = comma + 1;
+	}
+	return res;
+}
+
+bool tex_citations::isCommented(const char* s, size_t i)
+{
+	// an unescaped % earlier in the line
+	size_t start = i;
+	while (start > 0 && s[start - 1] != '\n')
+		start--;
+
+	for (size_t j = start; j < i; j++)
+	{
+		if (s[j] == '\\') j++;
+		else if (s[j] == '%') return true;
+	}
+	return false;
+}
+
+vector<string> tex_citations::findIncludes(const string& str)
+{
+	static const char* INCLUDE_COMMANDS[] = {"input", "include", "subfile", nullptr};
+
+	vector<string> res;
+	const char* s = str.data();
+	size_t n = str.length();
+
+	size_t i = 0;
+	while (i < n)
+	{
+		const char* p = (const char*)memchr(s + i, '\\', n - i);
+		if (p == nullptr) break;
+
+		size_t start = p - s + 1;
+		i = start;
+		while (i < n && isalpha((unsigned char)s[i]))
+			i++;
+
+		bool found = false;
+		for (int k = 0; INCLUDE_COMMANDS[k] != nullptr; k++)
+			if (strlen(INCLUDE_COMMANDS[k]) == i - start && memcmp(INCLUDE_COMMANDS[k], s + start, i - start) == 0)
+				found = true;
+		if (!found) continue;
+
+		size_t j = skipSpaces(s, n, i);
+		if (j >= n || s[j] != '{') continue;
+		size_t close = str.find('}', j);
+		if (close == string::npos) break;
+
+		string name = str.substr(j + 1, close - j - 1);
+		size_t b = name.find_first_not_of(" \t\r\n");
+		size_t e = name.find_last_not_of(" \t\r\n");
+		if (b != string::npos && !isCommented(s, start - 1))
+			res.push_back(name.substr(b, e - b + 1));
+		i = close + 1;
+	}
+
+	return res;
+}
+
+vector<string> tex_citations::findArguments(const string& s, const string& command)
+{
+	vector<string> res;
+	string prefix = "\\" + command + "{";
+	size_t i = s.find(prefix);
+	while (i != string::npos)
+	{
+		size_t start = i + prefix.length();
+		size_t close = s.find('}', start);
+		if (close == string::npos) break;
+
+		res.push_back(s.substr(start, close - start));
+		i = s.find(prefix, close + 1);
+	}
+	return res;
+}
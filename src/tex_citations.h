@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Linear-time scanner of citation commands in TeX sources
+class tex_citations
+{
+	static const char* COMMANDS[];
+
+	static bool isCommand(const char* s, size_t n);
+	static size_t skipSpaces(const char* s, size_t n, size_t i);
+	static size_t skipOptional(const char* s, size_t n, size_t i);
+	static bool isCommented(const char* s, size_t i);
+
+public:
+	// spans [begin, end) of the key lists of \cite-like commands, in the order of occurrence
+	static vector<pair<size_t, size_t> > findKeyLists(const string& s);
+	// spans of the comma-separated keys (spaces excluded) in the key list [begin, end)
+	static vector<pair<size_t, size_t> > splitKeys(const string& s, size_t begin, size_t end);
+	// file names of \input, \include and \subfile commands outside comments
+	static vector<string> findIncludes(const string& s);
+	// arguments of a command, e.g. of \citation and \@input in .aux files
+	static vector<string> findArguments(const string& s, const string& command);
+};
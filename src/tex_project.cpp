@@ -0,0 +1,181 @@
+#include "tex_project.h"
+#include "tex_citations.h"
+
+#include "logger.h"
+#include "string_utilities.h"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <sys/stat.h>
+
+#if defined _WIN32 || defined __CYGWIN__
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+using namespace string_utilities;
+
+unique_ptr<TexProject> TexProject::Create(const string& spec)
+{
+	auto res = unique_ptr<TexProject>(new TexProject());
+	for (auto& item : split(spec, ","))
+	{
+		string path = trim(item);
+		if (path == "") continue;
+
+		if (IsDirectory(path))
+			res->AddDirectory(path);
+		else
+			res->AddFile(path, DirName(path));
+	}
+
+	Logger::Debug("found " + to_string(res->files.size()) + " tex files");
+	return res;
+}
+
+void TexProject::AddFile(const string& path, const string& rootDir)
+{
+	string p = NormalizePath(path);
+	if (!visited.insert(p).second) return;
+
+	string content = ReadFile(p);
+	files.push_back(p);
+
+	auto includes = (IsAux(p) ? tex_citations::findArguments(content, "@input") : tex_citations::findIncludes(content));
+	for (auto& name : includes)
+	{
+		string included = ResolveInclude(name, DirName(p), rootDir);
+		if (included != "")
+			AddFile(included, rootDir);
+		else
+			Logger::Debug("included file '" + name + "' from " + p + " not found");
+	}
+}
+
+unordered_set<string> TexProject::CitedKeys() const
+{
+	unordered_set<string> res;
+	for (auto& file : files)
+	{
+		string content = ReadFile(file);
+		if (IsAux(file))
+		{
+			for (auto& list : tex_citations::findArguments(content, "citation"))
+				for (auto& key : split(list, ","))
+					res.insert(to_lower(trim(key)));
+			continue;
+		}
+
+		for (auto& list : tex_citations::findKeyLists(content))
+			for (auto& ref : tex_citations::splitKeys(content, list.first, list.second))
+				res.insert(to_lower(content.substr(ref.first, ref.second - ref.first)));
+	}
+
+	res.erase("");
+	return res;
+}
+
+string TexProject::ResolveInclude(const string& name, const string& dir, const string& rootDir) const
+{
+	// TeX resolves names relative to the main file, \subfile relative to the current one
+	const string dirs[] = {rootDir, dir};
+	for (auto& d : dirs)
+	{
+		string path = JoinPath(d, name);
+		if (IsFile(path + ".tex")) return path + ".tex";
+		if (IsFile(path)) return path;
+	}
+	return "";
+}
+
+void TexProject::AddDirectory(const string& path)
+{
+	vector<string> names;
+#if defined _WIN32 || defined __CYGWIN__
+	WIN32_FIND_DATAA data;
+	HANDLE handle = FindFirstFileA(JoinPath(path, "*").c_str(), &data);
+	Logger::Error(handle != INVALID_HANDLE_VALUE, "can't read directory '" + path + "'");
+	do
+		names.push_back(data.cFileName);
+	while (FindNextFileA(handle, &data));
+	FindClose(handle);
+#else
+	DIR* dir = opendir(path.c_str());
+	Logger::Error(dir != nullptr, "can't read directory '" + path + "'");
+	while (dirent* item = readdir(dir))
+		names.push_back(item->d_name);
+	closedir(dir);
+#endif
+
+	// sorted, so that the order of files does not depend on the file system
+	sort(names.begin(), names.end());
+	for (auto& name : names)
+	{
+		if (name == "" || name[0] == '.') continue;
+
+		string p = JoinPath(path, name);
+		if (IsDirectory(p))
+			AddDirectory(p);
+		else if (name.length() > 4 && name.substr(name.length() - 4) == ".tex")
+			AddFile(p, path);
+	}
+}
+
+bool TexProject::IsAux(const string& path)
+{
+	return path.length() > 4 && path.substr(path.length() - 4) == ".aux";
+}
+
+string TexProject::ReadFile(const string& path)
+{
+	ifstream is(path.c_str(), ios::in | ios::binary);
+	Logger::Error(is.good(), "can't open tex file '" + path + "'");
+	ostringstream buffer;
+	buffer << is.rdbuf();
+	return buffer.str();
+}
+
+bool TexProject::IsDirectory(const string& path)
+{
+	struct stat st;
+	return stat(path.c_str(), &st) == 0 && (st.st_mode & S_IFMT) == S_IFDIR;
+}
+
+bool TexProject::IsFile(const string& path)
+{
+	struct stat st;
+	return stat(path.c_str(), &st) == 0 && (st.st_mode & S_IFMT) == S_IFREG;
+}
+
+string TexProject::DirName(const string& path)
+{
+	size_t slash = path.find_last_of("/\\");
+	return (slash == string::npos ? "." : path.substr(0, slash));
+}
+
+string TexProject::NormalizePath(const string& path)
+{
+	// "." and "dir/.." components are removed, so that every file has a single name
+	vector<string> parts;
+	for (auto& part : split(replace(path, "\\", "/"), "/"))
+	{
+		if (part == "" || part == ".") continue;
+		if (part == ".." && !parts.empty() && parts.back() != "..")
+			parts.pop_back();
+		else
+			parts.push_back(part);
+	}
+
+	string res = (!path.empty() && path[0] == '/' ? "/" : "");
+	for (int i = 0; i < (int)parts.size(); i++)
+		res += (i > 0 ? "/" : "") + parts[i];
+	return (res == "" ? "." : res);
+}
+
+string TexProject::JoinPath(const string& dir, const string& name)
+{
+	if (dir == "" || dir == "." || name.empty() || name[0] == '/') return name;
+	return dir + "/" + name;
+}
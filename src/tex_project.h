@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <set>
+#include <unordered_set>
+#include <memory>
+
+using namespace std;
+
+// TeX files of a project: the files reachable from the given ones through
+// \input, \include and \subfile, and the .tex files in the given directories;
+// .aux files are followed through \@input
+class TexProject
+{
+	vector<string> files;
+	set<string> visited;
+
+private:
+	TexProject(const TexProject&);
+	TexProject& operator = (const TexProject&);
+	TexProject() {}
+
+	void AddFile(const string& path, const string& rootDir);
+	void AddDirectory(const string& path);
+	string ResolveInclude(const string& name, const string& dir, const string& rootDir) const;
+
+	static bool IsAux(const string& path);
+	static string ReadFile(const string& path);
+	static bool IsDirectory(const string& path);
+	static bool IsFile(const string& path);
+	static string DirName(const string& path);
+	static string NormalizePath(const string& path);
+	static string JoinPath(const string& dir, const string& name);
+
+public:
+	// a comma-separated list of files and directories
+	static unique_ptr<TexProject> Create(const string& spec);
+
+	const vector<string>& getFiles() const { return files; }
+
+	// keys (in lower case) of \citation lines in .aux files and of citation commands in .tex files
+	unordered_set<string> CitedKeys() const;
+};
@@ -1,87 +1,151 @@
 #include "unicode_latex.h"
 
-#include <vector>
-#include <map>
-
 #include "logger.h"
 
+#include <cstring>
+#include <cstdint>
+#include <cctype>
+#include <algorithm>
+
+#if defined __SSE2__
+#include <emmintrin.h>
+#endif
+
+size_t unicode_latex::asciiLength(const char* s, size_t n)
+{
+	size_t i = 0;
+#if defined __SSE2__
+	// 16 bytes at a time: movemask collects the high bit of every byte
+	for (; i + 16 <= n; i += 16)
+	{
+		int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+		if (mask != 0)
+			return i + __builtin_ctz(mask);
+	}
+#else
+	for (; i + 8 <= n; i += 8)
+	{
+		uint64_t word;
+		memcpy(&word, s + i, 8);
+		if (word & 0x8080808080808080ULL)
+			break;
+	}
+#endif
+	while (i < n && (unsigned char)s[i] <= 0x7F)
+		i++;
+	return i;
+}
+
+bool unicode_latex::isAscii(const string& s)
+{
+	return asciiLength(s.data(), s.size()) == s.size();
+}
+
 string unicode_latex::transform(const string& s)
 {
+	const char* data = s.data();
+	size_t n = s.size();
+
+	size_t i = asciiLength(data, n);
+	if (i == n) return s;
+
+	// decomposed input: combining marks U+0300..U+036F start with 0xCC or 0xCD
+	string composed;
+	if (memchr(data + i, 0xCC, n - i) != nullptr || memchr(data + i, 0xCD, n - i) != nullptr)
+	{
+		composed = compose(s);
+		data = composed.data();
+		n = composed.size();
+		i = asciiLength(data, n);
+	}
+
 	string res;
+	res.reserve(n + n / 4);
+	res.append(data, i);
+
+	// where the output of the last letter starts, for combining marks that were not composed
+	size_t base = (i > 0 && isalnum((unsigned char)data[i - 1]) ? i - 1 : string::npos);
+
+	while (i < n)
+	{
+		// copying ASCII runs in bulk
+		size_t run = asciiLength(data + i, n - i);
+		res.append(data + i, run);
+		i += run;
+		if (run > 0)
+			base = (isalnum((unsigned char)data[i - 1]) ? res.size() - 1 : string::npos);
+		if (i == n) break;
 
-    size_t i = 0;
-    while (i < s.size())
-    {
-		string cur;
-        unsigned long uni;
-        size_t todo;
-        unsigned char ch = s[i++];
-		cur += ch;
-        if (ch <= 0x7F)
-        {
-            uni = ch;
-            todo = 0;
-        }
-        else if (ch <= 0xBF)
-        {
+		// decoding a multi-byte sequence
+		size_t start = i;
+		unsigned long uni;
+		size_t todo;
+		unsigned char ch = data[i++];
+		if (ch <= 0xBF)
+		{
 			Logger::Warning("not a UTF-8 string: '" + s + "'");
 			return s;
-        }
-        else if (ch <= 0xDF)
-        {
-            uni = ch&0x1F;
-            todo = 1;
-        }
-        else if (ch <= 0xEF)
-        {
-            uni = ch&0x0F;
-            todo = 2;
-        }
-        else if (ch <= 0xF7)
-        {
-            uni = ch&0x07;
-            todo = 3;
-        }
-        else
-        {
+		}
+		else if (ch <= 0xDF)
+		{
+			uni = ch&0x1F;
+			todo = 1;
+		}
+		else if (ch <= 0xEF)
+		{
+			uni = ch&0x0F;
+			todo = 2;
+		}
+		else if (ch <= 0xF7)
+		{
+			uni = ch&0x07;
+			todo = 3;
+		}
+		else
+		{
 			Logger::Warning("not a UTF-8 string: '" + s + "'");
 			return s;
-        }
+		}
 
-        for (size_t j = 0; j < todo; j++)
-        {
-            if (i == s.size())
+		for (size_t j = 0; j < todo; j++)
+		{
+			if (i == n)
 			{
 				Logger::Warning("not a UTF-8 string: '" + s + "'");
 				return s;
 			}
-            unsigned char ch = s[i++];
-			cur += ch;
-            if (ch < 0x80 || ch > 0xBF)
+			unsigned char ch = data[i++];
+			if (ch < 0x80 || ch > 0xBF)
 			{
 				Logger::Warning("not a UTF-8 string: '" + s + "'");
 				return s;
 			}
-            uni <<= 6;
-            uni += ch & 0x3F;
-        }
+			uni <<= 6;
+			uni += ch & 0x3F;
+		}
 
-        if (uni >= 0xD800 && uni <= 0xDFFF)
+		if ((uni >= 0xD800 && uni <= 0xDFFF) || uni > 0x10FFFF)
 		{
 			Logger::Warning("not a UTF-8 string: '" + s + "'");
 			return s;
 		}
-        if (uni > 0x10FFFF)
+
+		const char* latex = find(uni);
+		bool mark = (uni >= 0x300 && uni <= 0x36F);
+		if (mark && latex != nullptr && base != string::npos && latex[0] == '\\' && strlen(latex) == 2)
 		{
-			Logger::Warning("not a UTF-8 string: '" + s + "'");
-			return s;
+			// an accent command taking the preceding letter, e.g. x followed by U+0307 is \.{x}
+			res.insert(base, string(latex) + "{");
+			res += '}';
+			continue;
 		}
 
-		if (todo > 0 && substMap.count(uni))
-			res += substMap.find(uni)->second;
+		base = (mark ? string::npos : res.size());
+		if (latex != nullptr)
+			res += latex;
 		else
-			res += cur;
-    }
+			res.append(data + start, i - start);
+	}
 
 	return res;
 }
@@ -93,8 +157,9 @@ string unicode_latex::transform(char c1, char c2)
 	uni <<= 6;
     uni += c2 & 0x3F;
 
-	if (substMap.count(uni))
-		return substMap.find(uni)->second;
+	const char* latex = find(uni);
+	if (latex != nullptr)
+		return latex;
 
 	string res;
 	res += c1;
@@ -102,2366 +167,3155 @@ string unicode_latex::transform(char c1, char c2)
 	return res;
 }
 
-const map<unsigned long, string> unicode_latex::substMap = unicode_latex::initMap();
+bool unicode_latex::decode(const char* s, size_t n, size_t& i, unsigned long& code)
+{
+	unsigned char ch = s[i];
+	size_t todo;
+	if (ch <= 0x7F) code = ch, todo = 0;
+	else if (ch <= 0xBF) return false;
+	else if (ch <= 0xDF) code = ch & 0x1F, todo = 1;
+	else if (ch <= 0xEF) code = ch & 0x0F, todo = 2;
+	else if (ch <= 0xF7) code = ch & 0x07, todo = 3;
+	else return false;
+
+	if (i + todo >= n) return false;
+	for (size_t j = 1; j <= todo; j++)
+	{
+		unsigned char c = s[i + j];
+		if (c < 0x80 || c > 0xBF) return false;
+		code = (code << 6) + (c & 0x3F);
+	}
+
+	i += todo + 1;
+	return true;
+}
 
-map<unsigned long, string> unicode_latex::initMap()
+unsigned long unicode_latex::findComposition(unsigned long base, unsigned long mark)
 {
-    map<unsigned long, string> m;
-	m[32] = "\\space ";
-	m[35] = "\\#";
-	m[36] = "\\textdollar ";
-	m[37] = "\\%";
-	m[38] = "\\&amp;";
-	m[39] = "\\textquotesingle ";
-	m[42] = "\\ast ";
-	m[92] = "\\textbackslash ";
-	m[94] = "\\^{}";
-	m[95] = "\\_";
-	m[96] = "\\textasciigrave ";
-	m[123] = "\\lbrace ";
-	m[124] = "\\vert ";
-	m[125] = "\\rbrace ";
-	m[126] = "\\textasciitilde ";
-	m[161] = "\\textexclamdown ";
-	m[162] = "\\textcent ";
-	m[163] = "\\textsterling ";
-	m[164] = "\\textcurrency ";
-	m[165] = "\\textyen ";
-	m[166] = "\\textbrokenbar ";
-	m[167] = "\\textsection ";
-	m[168] = "\\textasciidieresis ";
-	m[169] = "\\textcopyright ";
-	m[170] = "\\textordfeminine ";
-	m[171] = "\\guillemotleft ";
-	m[172] = "\\lnot ";
-	m[173] = "\\-";
-	m[174] = "\\textregistered ";
-	m[175] = "\\textasciimacron ";
-	m[176] = "\\textdegree ";
-	m[177] = "\\pm ";
-	m[178] = "{^2}";
-	m[179] = "{^3}";
-	m[180] = "\\textasciiacute ";
-	m[181] = "\\mathrm{\\mu}";
-	m[182] = "\\textparagraph ";
-	m[183] = "\\cdot ";
-	m[184] = "\\c{}";
-	m[185] = "{^1}";
-	m[186] = "\\textordmasculine ";
-	m[187] = "\\guillemotright ";
-	m[188] = "\\textonequarter ";
-	m[189] = "\\textonehalf ";
-	m[190] = "\\textthreequarters ";
-	m[191] = "\\textquestiondown ";
-	m[192] = "\\`{A}";
-	m[193] = "\\'{A}";
-	m[194] = "\\^{A}";
-	m[195] = "\\~{A}";
-	m[196] = "\\\"{A}";
-	m[197] = "\\AA ";
-	m[198] = "\\AE ";
-	m[199] = "\\c{C}";
-	m[200] = "\\`{E}";
-	m[201] = "\\'{E}";
-	m[202] = "\\^{E}";
-	m[203] = "\\\"{E}";
-	m[204] = "\\`{I}";
-	m[205] = "\\'{I}";
-	m[206] = "\\^{I}";
-	m[207] = "\\\"{I}";
-	m[208] = "\\DH ";
-	m[209] = "\\~{N}";
-	m[210] = "\\`{O}";
-	m[211] = "\\'{O}";
-	m[212] = "\\^{O}";
-	m[213] = "\\~{O}";
-	m[214] = "\\\"{O}";
-	m[215] = "\\texttimes ";
-	m[216] = "\\O ";
-	m[217] = "\\`{U}";
-	m[218] = "\\'{U}";
-	m[219] = "\\^{U}";
-	m[220] = "\\\"{U}";
-	m[221] = "\\'{Y}";
-	m[222] = "\\TH ";
-	m[223] = "\\ss ";
-	m[224] = "\\`{a}";
-	m[225] = "\\'{a}";
-	m[226] = "\\^{a}";
-	m[227] = "\\~{a}";
-	m[228] = "\\\"{a}";
-	m[229] = "\\aa ";
-	m[230] = "\\ae ";
-	m[231] = "\\c{c}";
-	m[232] = "\\`{e}";
-	m[233] = "\\'{e}";
-	m[234] = "\\^{e}";
-	m[235] = "\\\"{e}";
-	m[236] = "\\`{\\i}";
-	m[237] = "\\'{\\i}";
-	m[238] = "\\^{\\i}";
-	m[239] = "\\\"{\\i}";
-	m[240] = "\\dh ";
-	m[241] = "\\~{n}";
-	m[242] = "\\`{o}";
-	m[243] = "\\'{o}";
-	m[244] = "\\^{o}";
-	m[245] = "\\~{o}";
-	m[246] = "\\\"{o}";
-	m[247] = "\\div ";
-	m[248] = "\\o ";
-	m[249] = "\\`{u}";
-	m[250] = "\\'{u}";
-	m[251] = "\\^{u}";
-	m[252] = "\\\"{u}";
-	m[253] = "\\'{y}";
-	m[254] = "\\th ";
-	m[255] = "\\\"{y}";
-	m[256] = "\\={A}";
-	m[257] = "\\={a}";
-	m[258] = "\\u{A}";
-	m[259] = "\\u{a}";
-	m[260] = "\\k{A}";
-	m[261] = "\\k{a}";
-	m[262] = "\\'{C}";
-	m[263] = "\\'{c}";
-	m[264] = "\\^{C}";
-	m[265] = "\\^{c}";
-	m[266] = "\\.{C}";
-	m[267] = "\\.{c}";
-	m[268] = "\\v{C}";
-	m[269] = "\\v{c}";
-	m[270] = "\\v{D}";
-	m[271] = "\\v{d}";
-	m[272] = "\\DJ ";
-	m[273] = "\\dj ";
-	m[274] = "\\={E}";
-	m[275] = "\\={e}";
-	m[276] = "\\u{E}";
-	m[277] = "\\u{e}";
-	m[278] = "\\.{E}";
-	m[279] = "\\.{e}";
-	m[280] = "\\k{E}";
-	m[281] = "\\k{e}";
-	m[282] = "\\v{E}";
-	m[283] = "\\v{e}";
-	m[284] = "\\^{G}";
-	m[285] = "\\^{g}";
-	m[286] = "\\u{G}";
-	m[287] = "\\u{g}";
-	m[288] = "\\.{G}";
-	m[289] = "\\.{g}";
-	m[290] = "\\c{G}";
-	m[291] = "\\c{g}";
-	m[292] = "\\^{H}";
-	m[293] = "\\^{h}";
-	m[294] = "{\\fontencoding{LELA}\\selectfont\\char40}";
-	m[295] = "\\Elzxh ";
-	m[296] = "\\~{I}";
-	m[297] = "\\~{\\i}";
-	m[298] = "\\={I}";
-	m[299] = "\\={\\i}";
-	m[300] = "\\u{I}";
-	m[301] = "\\u{\\i}";
-	m[302] = "\\k{I}";
-	m[303] = "\\k{i}";
-	m[304] = "\\.{I}";
-	m[305] = "\\i ";
-	m[306] = "IJ";
-	m[307] = "ij";
-	m[308] = "\\^{J}";
-	m[309] = "\\^{\\j}";
-	m[310] = "\\c{K}";
-	m[311] = "\\c{k}";
-	m[312] = "{\\fontencoding{LELA}\\selectfont\\char91}";
-	m[313] = "\\'{L}";
-	m[314] = "\\'{l}";
-	m[315] = "\\c{L}";
-	m[316] = "\\c{l}";
-	m[317] = "\\v{L}";
-	m[318] = "\\v{l}";
-	m[319] = "{\\fontencoding{LELA}\\selectfont\\char201}";
-	m[320] = "{\\fontencoding{LELA}\\selectfont\\char202}";
-	m[321] = "\\L ";
-	m[322] = "\\l ";
-	m[323] = "\\'{N}";
-	m[324] = "\\'{n}";
-	m[325] = "\\c{N}";
-	m[326] = "\\c{n}";
-	m[327] = "\\v{N}";
-	m[328] = "\\v{n}";
-	m[329] = "'n";
-	m[330] = "\\NG ";
-	m[331] = "\\ng ";
-	m[332] = "\\={O}";
-	m[333] = "\\={o}";
-	m[334] = "\\u{O}";
-	m[335] = "\\u{o}";
-	m[336] = "\\H{O}";
-	m[337] = "\\H{o}";
-	m[338] = "\\OE ";
-	m[339] = "\\oe ";
-	m[340] = "\\'{R}";
-	m[341] = "\\'{r}";
-	m[342] = "\\c{R}";
-	m[343] = "\\c{r}";
-	m[344] = "\\v{R}";
-	m[345] = "\\v{r}";
-	m[346] = "\\'{S}";
-	m[347] = "\\'{s}";
-	m[348] = "\\^{S}";
-	m[349] = "\\^{s}";
-	m[350] = "\\c{S}";
-	m[351] = "\\c{s}";
-	m[352] = "\\v{S}";
-	m[353] = "\\v{s}";
-	m[354] = "\\c{T}";
-	m[355] = "\\c{t}";
-	m[356] = "\\v{T}";
-	m[357] = "\\v{t}";
-	m[358] = "{\\fontencoding{LELA}\\selectfont\\char47}";
-	m[359] = "{\\fontencoding{LELA}\\selectfont\\char63}";
-	m[360] = "\\~{U}";
-	m[361] = "\\~{u}";
-	m[362] = "\\={U}";
-	m[363] = "\\={u}";
-	m[364] = "\\u{U}";
-	m[365] = "\\u{u}";
-	m[366] = "\\r{U}";
-	m[367] = "\\r{u}";
-	m[368] = "\\H{U}";
-	m[369] = "\\H{u}";
-	m[370] = "\\k{U}";
-	m[371] = "\\k{u}";
-	m[372] = "\\^{W}";
-	m[373] = "\\^{w}";
-	m[374] = "\\^{Y}";
-	m[375] = "\\^{y}";
-	m[376] = "\\\"{Y}";
-	m[377] = "\\'{Z}";
-	m[378] = "\\'{z}";
-	m[379] = "\\.{Z}";
-	m[380] = "\\.{z}";
-	m[381] = "\\v{Z}";
-	m[382] = "\\v{z}";
-	m[405] = "\\texthvlig ";
-	m[414] = "\\textnrleg ";
-	m[426] = "\\eth ";
-	m[442] = "{\\fontencoding{LELA}\\selectfont\\char195}";
-	m[450] = "\\textdoublepipe ";
-	m[501] = "\\'{g}";
-	m[592] = "\\Elztrna ";
-	m[594] = "\\Elztrnsa ";
-	m[596] = "\\Elzopeno ";
-	m[598] = "\\Elzrtld ";
-	m[600] = "{\\fontencoding{LEIP}\\selectfont\\char61}";
-	m[601] = "\\Elzschwa ";
-	m[603] = "\\varepsilon ";
-	m[611] = "\\Elzpgamma ";
-	m[612] = "\\Elzpbgam ";
-	m[613] = "\\Elztrnh ";
-	m[620] = "\\Elzbtdl ";
-	m[621] = "\\Elzrtll ";
-	m[623] = "\\Elztrnm ";
-	m[624] = "\\Elztrnmlr ";
-	m[625] = "\\Elzltlmr ";
-	m[626] = "\\Elzltln ";
-	m[627] = "\\Elzrtln ";
-	m[631] = "\\Elzclomeg ";
-	m[632] = "\\textphi ";
-	m[633] = "\\Elztrnr ";
-	m[634] = "\\Elztrnrl ";
-	m[635] = "\\Elzrttrnr ";
-	m[636] = "\\Elzrl ";
-	m[637] = "\\Elzrtlr ";
-	m[638] = "\\Elzfhr ";
-	m[639] = "{\\fontencoding{LEIP}\\selectfont\\char202}";
-	m[642] = "\\Elzrtls ";
-	m[643] = "\\Elzesh ";
-	m[647] = "\\Elztrnt ";
-	m[648] = "\\Elzrtlt ";
-	m[650] = "\\Elzpupsil ";
-	m[651] = "\\Elzpscrv ";
-	m[652] = "\\Elzinvv ";
-	m[653] = "\\Elzinvw ";
-	m[654] = "\\Elztrny ";
-	m[656] = "\\Elzrtlz ";
-	m[658] = "\\Elzyogh ";
-	m[660] = "\\Elzglst ";
-	m[661] = "\\Elzreglst ";
-	m[662] = "\\Elzinglst ";
-	m[670] = "\\textturnk ";
-	m[676] = "\\Elzdyogh ";
-	m[679] = "\\Elztesh ";
-	m[711] = "\\textasciicaron ";
-	m[712] = "\\Elzverts ";
-	m[716] = "\\Elzverti ";
-	m[720] = "\\Elzlmrk ";
-	m[721] = "\\Elzhlmrk ";
-	m[722] = "\\Elzsbrhr ";
-	m[723] = "\\Elzsblhr ";
-	m[724] = "\\Elzrais ";
-	m[725] = "\\Elzlow ";
-	m[728] = "\\textasciibreve ";
-	m[729] = "\\textperiodcentered ";
-	m[730] = "\\r{}";
-	m[731] = "\\k{}";
-	m[732] = "\\texttildelow ";
-	m[733] = "\\H{}";
-	m[741] = "\\tone{55}";
-	m[742] = "\\tone{44}";
-	m[743] = "\\tone{33}";
-	m[744] = "\\tone{22}";
-	m[745] = "\\tone{11}";
-	m[768] = "\\`";
-	m[769] = "\\'";
-	m[770] = "\\^";
-	m[771] = "\\~";
-	m[772] = "\\=";
-	m[774] = "\\u";
-	m[775] = "\\.";
-	m[776] = "\\\"";
-	m[778] = "\\r";
-	m[779] = "\\H";
-	m[780] = "\\v";
-	m[783] = "\\cyrchar\\C";
-	m[785] = "{\\fontencoding{LECO}\\selectfont\\char177}";
-	m[792] = "{\\fontencoding{LECO}\\selectfont\\char184}";
-	m[793] = "{\\fontencoding{LECO}\\selectfont\\char185}";
-	m[801] = "\\Elzpalh ";
-	m[802] = "\\Elzrh ";
-	m[807] = "\\c";
-	m[808] = "\\k";
-	m[810] = "\\Elzsbbrg ";
-	m[811] = "{\\fontencoding{LECO}\\selectfont\\char203}";
-	m[815] = "{\\fontencoding{LECO}\\selectfont\\char207}";
-	m[821] = "\\Elzxl ";
-	m[822] = "\\Elzbar ";
-	m[823] = "{\\fontencoding{LECO}\\selectfont\\char215}";
-	m[824] = "{\\fontencoding{LECO}\\selectfont\\char216}";
-	m[826] = "{\\fontencoding{LECO}\\selectfont\\char218}";
-	m[827] = "{\\fontencoding{LECO}\\selectfont\\char219}";
-	m[828] = "{\\fontencoding{LECO}\\selectfont\\char220}";
-	m[829] = "{\\fontencoding{LECO}\\selectfont\\char221}";
-	m[865] = "{\\fontencoding{LECO}\\selectfont\\char225}";
-	m[902] = "\\'{A}";
-	m[904] = "\\'{E}";
-	m[905] = "\\'{H}";
-	m[906] = "\\'{}{I}";
-	m[908] = "\\'{}O";
-	m[910] = "\\mathrm{'Y}";
-	m[911] = "\\mathrm{'\\Omega}";
-	m[912] = "\\acute{\\ddot{\\iota}}";
-	m[913] = "\\Alpha ";
-	m[914] = "\\Beta ";
-	m[915] = "\\Gamma ";
-	m[916] = "\\Delta ";
-	m[917] = "\\Epsilon ";
-	m[918] = "\\Zeta ";
-	m[919] = "\\Eta ";
-	m[920] = "\\Theta ";
-	m[921] = "\\Iota ";
-	m[922] = "\\Kappa ";
-	m[923] = "\\Lambda ";
-	m[926] = "\\Xi ";
-	m[928] = "\\Pi ";
-	m[929] = "\\Rho ";
-	m[931] = "\\Sigma ";
-	m[932] = "\\Tau ";
-	m[933] = "\\Upsilon ";
-	m[934] = "\\Phi ";
-	m[935] = "\\Chi ";
-	m[936] = "\\Psi ";
-	m[937] = "\\Omega ";
-	m[938] = "\\mathrm{\\ddot{I}}";
-	m[939] = "\\mathrm{\\ddot{Y}}";
-	m[940] = "\\'{$\\alpha$}";
-	m[941] = "\\acute{\\epsilon}";
-	m[942] = "\\acute{\\eta}";
-	m[943] = "\\acute{\\iota}";
-	m[944] = "\\acute{\\ddot{\\upsilon}}";
-	m[945] = "\\alpha ";
-	m[946] = "\\beta ";
-	m[947] = "\\gamma ";
-	m[948] = "\\delta ";
-	m[949] = "\\epsilon ";
-	m[950] = "\\zeta ";
-	m[951] = "\\eta ";
-	m[952] = "\\texttheta ";
-	m[953] = "\\iota ";
-	m[954] = "\\kappa ";
-	m[955] = "\\lambda ";
-	m[956] = "\\mu ";
-	m[957] = "\\nu ";
-	m[958] = "\\xi ";
-	m[960] = "\\pi ";
-	m[961] = "\\rho ";
-	m[962] = "\\varsigma ";
-	m[963] = "\\sigma ";
-	m[964] = "\\tau ";
-	m[965] = "\\upsilon ";
-	m[966] = "\\varphi ";
-	m[967] = "\\chi ";
-	m[968] = "\\psi ";
-	m[969] = "\\omega ";
-	m[970] = "\\ddot{\\iota}";
-	m[971] = "\\ddot{\\upsilon}";
-	m[972] = "\\'{o}";
-	m[973] = "\\acute{\\upsilon}";
-	m[974] = "\\acute{\\omega}";
-	m[976] = "\\Pisymbol{ppi022}{87}";
-	m[977] = "\\textvartheta ";
-	m[978] = "\\Upsilon ";
-	m[981] = "\\phi ";
-	m[982] = "\\varpi ";
-	m[986] = "\\Stigma ";
-	m[988] = "\\Digamma ";
-	m[989] = "\\digamma ";
-	m[990] = "\\Koppa ";
-	m[992] = "\\Sampi ";
-	m[1008] = "\\varkappa ";
-	m[1009] = "\\varrho ";
-	m[1012] = "\\textTheta ";
-	m[1014] = "\\backepsilon ";
-	m[1025] = "\\cyrchar\\CYRYO ";
-	m[1026] = "\\cyrchar\\CYRDJE ";
-	m[1027] = "\\cyrchar{\\'\\CYRG}";
-	m[1028] = "\\cyrchar\\CYRIE ";
-	m[1029] = "\\cyrchar\\CYRDZE ";
-	m[1030] = "\\cyrchar\\CYRII ";
-	m[1031] = "\\cyrchar\\CYRYI ";
-	m[1032] = "\\cyrchar\\CYRJE ";
-	m[1033] = "\\cyrchar\\CYRLJE ";
-	m[1034] = "\\cyrchar\\CYRNJE ";
-	m[1035] = "\\cyrchar\\CYRTSHE ";
-	m[1036] = "\\cyrchar{\\'\\CYRK}";
-	m[1038] = "\\cyrchar\\CYRUSHRT ";
-	m[1039] = "\\cyrchar\\CYRDZHE ";
-	m[1040] = "\\cyrchar\\CYRA ";
-	m[1041] = "\\cyrchar\\CYRB ";
-	m[1042] = "\\cyrchar\\CYRV ";
-	m[1043] = "\\cyrchar\\CYRG ";
-	m[1044] = "\\cyrchar\\CYRD ";
-	m[1045] = "\\cyrchar\\CYRE ";
-	m[1046] = "\\cyrchar\\CYRZH ";
-	m[1047] = "\\cyrchar\\CYRZ ";
-	m[1048] = "\\cyrchar\\CYRI ";
-	m[1049] = "\\cyrchar\\CYRISHRT ";
-	m[1050] = "\\cyrchar\\CYRK ";
-	m[1051] = "\\cyrchar\\CYRL ";
-	m[1052] = "\\cyrchar\\CYRM ";
-	m[1053] = "\\cyrchar\\CYRN ";
-	m[1054] = "\\cyrchar\\CYRO ";
-	m[1055] = "\\cyrchar\\CYRP ";
-	m[1056] = "\\cyrchar\\CYRR ";
-	m[1057] = "\\cyrchar\\CYRS ";
-	m[1058] = "\\cyrchar\\CYRT ";
-	m[1059] = "\\cyrchar\\CYRU ";
-	m[1060] = "\\cyrchar\\CYRF ";
-	m[1061] = "\\cyrchar\\CYRH ";
-	m[1062] = "\\cyrchar\\CYRC ";
-	m[1063] = "\\cyrchar\\CYRCH ";
-	m[1064] = "\\cyrchar\\CYRSH ";
-	m[1065] = "\\cyrchar\\CYRSHCH ";
-	m[1066] = "\\cyrchar\\CYRHRDSN ";
-	m[1067] = "\\cyrchar\\CYRERY ";
-	m[1068] = "\\cyrchar\\CYRSFTSN ";
-	m[1069] = "\\cyrchar\\CYREREV ";
-	m[1070] = "\\cyrchar\\CYRYU ";
-	m[1071] = "\\cyrchar\\CYRYA ";
-	m[1072] = "\\cyrchar\\cyra ";
-	m[1073] = "\\cyrchar\\cyrb ";
-	m[1074] = "\\cyrchar\\cyrv ";
-	m[1075] = "\\cyrchar\\cyrg ";
-	m[1076] = "\\cyrchar\\cyrd ";
-	m[1077] = "\\cyrchar\\cyre ";
-	m[1078] = "\\cyrchar\\cyrzh ";
-	m[1079] = "\\cyrchar\\cyrz ";
-	m[1080] = "\\cyrchar\\cyri ";
-	m[1081] = "\\cyrchar\\cyrishrt ";
-	m[1082] = "\\cyrchar\\cyrk ";
-	m[1083] = "\\cyrchar\\cyrl ";
-	m[1084] = "\\cyrchar\\cyrm ";
-	m[1085] = "\\cyrchar\\cyrn ";
-	m[1086] = "\\cyrchar\\cyro ";
-	m[1087] = "\\cyrchar\\cyrp ";
-	m[1088] = "\\cyrchar\\cyrr ";
-	m[1089] = "\\cyrchar\\cyrs ";
-	m[1090] = "\\cyrchar\\cyrt ";
-	m[1091] = "\\cyrchar\\cyru ";
-	m[1092] = "\\cyrchar\\cyrf ";
-	m[1093] = "\\cyrchar\\cyrh ";
-	m[1094] = "\\cyrchar\\cyrc ";
-	m[1095] = "\\cyrchar\\cyrch ";
-	m[1096] = "\\cyrchar\\cyrsh ";
-	m[1097] = "\\cyrchar\\cyrshch ";
-	m[1098] = "\\cyrchar\\cyrhrdsn ";
-	m[1099] = "\\cyrchar\\cyrery ";
-	m[1100] = "\\cyrchar\\cyrsftsn ";
-	m[1101] = "\\cyrchar\\cyrerev ";
-	m[1102] = "\\cyrchar\\cyryu ";
-	m[1103] = "\\cyrchar\\cyrya ";
-	m[1105] = "\\cyrchar\\cyryo ";
-	m[1106] = "\\cyrchar\\cyrdje ";
-	m[1107] = "\\cyrchar{\\'\\cyrg}";
-	m[1108] = "\\cyrchar\\cyrie ";
-	m[1109] = "\\cyrchar\\cyrdze ";
-	m[1110] = "\\cyrchar\\cyrii ";
-	m[1111] = "\\cyrchar\\cyryi ";
-	m[1112] = "\\cyrchar\\cyrje ";
-	m[1113] = "\\cyrchar\\cyrlje ";
-	m[1114] = "\\cyrchar\\cyrnje ";
-	m[1115] = "\\cyrchar\\cyrtshe ";
-	m[1116] = "\\cyrchar{\\'\\cyrk}";
-	m[1118] = "\\cyrchar\\cyrushrt ";
-	m[1119] = "\\cyrchar\\cyrdzhe ";
-	m[1120] = "\\cyrchar\\CYROMEGA ";
-	m[1121] = "\\cyrchar\\cyromega ";
-	m[1122] = "\\cyrchar\\CYRYAT ";
-	m[1124] = "\\cyrchar\\CYRIOTE ";
-	m[1125] = "\\cyrchar\\cyriote ";
-	m[1126] = "\\cyrchar\\CYRLYUS ";
-	m[1127] = "\\cyrchar\\cyrlyus ";
-	m[1128] = "\\cyrchar\\CYRIOTLYUS ";
-	m[1129] = "\\cyrchar\\cyriotlyus ";
-	m[1130] = "\\cyrchar\\CYRBYUS ";
-	m[1132] = "\\cyrchar\\CYRIOTBYUS ";
-	m[1133] = "\\cyrchar\\cyriotbyus ";
-	m[1134] = "\\cyrchar\\CYRKSI ";
-	m[1135] = "\\cyrchar\\cyrksi ";
-	m[1136] = "\\cyrchar\\CYRPSI ";
-	m[1137] = "\\cyrchar\\cyrpsi ";
-	m[1138] = "\\cyrchar\\CYRFITA ";
-	m[1140] = "\\cyrchar\\CYRIZH ";
-	m[1144] = "\\cyrchar\\CYRUK ";
-	m[1145] = "\\cyrchar\\cyruk ";
-	m[1146] = "\\cyrchar\\CYROMEGARND ";
-	m[1147] = "\\cyrchar\\cyromegarnd ";
-	m[1148] = "\\cyrchar\\CYROMEGATITLO ";
-	m[1149] = "\\cyrchar\\cyromegatitlo ";
-	m[1150] = "\\cyrchar\\CYROT ";
-	m[1151] = "\\cyrchar\\cyrot ";
-	m[1152] = "\\cyrchar\\CYRKOPPA ";
-	m[1153] = "\\cyrchar\\cyrkoppa ";
-	m[1154] = "\\cyrchar\\cyrthousands ";
-	m[1160] = "\\cyrchar\\cyrhundredthousands ";
-	m[1161] = "\\cyrchar\\cyrmillions ";
-	m[1164] = "\\cyrchar\\CYRSEMISFTSN ";
-	m[1165] = "\\cyrchar\\cyrsemisftsn ";
-	m[1166] = "\\cyrchar\\CYRRTICK ";
-	m[1167] = "\\cyrchar\\cyrrtick ";
-	m[1168] = "\\cyrchar\\CYRGUP ";
-	m[1169] = "\\cyrchar\\cyrgup ";
-	m[1170] = "\\cyrchar\\CYRGHCRS ";
-	m[1171] = "\\cyrchar\\cyrghcrs ";
-	m[1172] = "\\cyrchar\\CYRGHK ";
-	m[1173] = "\\cyrchar\\cyrghk ";
-	m[1174] = "\\cyrchar\\CYRZHDSC ";
-	m[1175] = "\\cyrchar\\cyrzhdsc ";
-	m[1176] = "\\cyrchar\\CYRZDSC ";
-	m[1177] = "\\cyrchar\\cyrzdsc ";
-	m[1178] = "\\cyrchar\\CYRKDSC ";
-	m[1179] = "\\cyrchar\\cyrkdsc ";
-	m[1180] = "\\cyrchar\\CYRKVCRS ";
-	m[1181] = "\\cyrchar\\cyrkvcrs ";
-	m[1182] = "\\cyrchar\\CYRKHCRS ";
-	m[1183] = "\\cyrchar\\cyrkhcrs ";
-	m[1184] = "\\cyrchar\\CYRKBEAK ";
-	m[1185] = "\\cyrchar\\cyrkbeak ";
-	m[1186] = "\\cyrchar\\CYRNDSC ";
-	m[1187] = "\\cyrchar\\cyrndsc ";
-	m[1188] = "\\cyrchar\\CYRNG ";
-	m[1189] = "\\cyrchar\\cyrng ";
-	m[1190] = "\\cyrchar\\CYRPHK ";
-	m[1191] = "\\cyrchar\\cyrphk ";
-	m[1192] = "\\cyrchar\\CYRABHHA ";
-	m[1193] = "\\cyrchar\\cyrabhha ";
-	m[1194] = "\\cyrchar\\CYRSDSC ";
-	m[1195] = "\\cyrchar\\cyrsdsc ";
-	m[1196] = "\\cyrchar\\CYRTDSC ";
-	m[1197] = "\\cyrchar\\cyrtdsc ";
-	m[1198] = "\\cyrchar\\CYRY ";
-	m[1199] = "\\cyrchar\\cyry ";
-	m[1200] = "\\cyrchar\\CYRYHCRS ";
-	m[1201] = "\\cyrchar\\cyryhcrs ";
-	m[1202] = "\\cyrchar\\CYRHDSC ";
-	m[1203] = "\\cyrchar\\cyrhdsc ";
-	m[1204] = "\\cyrchar\\CYRTETSE ";
-	m[1205] = "\\cyrchar\\cyrtetse ";
-	m[1206] = "\\cyrchar\\CYRCHRDSC ";
-	m[1207] = "\\cyrchar\\cyrchrdsc ";
-	m[1208] = "\\cyrchar\\CYRCHVCRS ";
-	m[1209] = "\\cyrchar\\cyrchvcrs ";
-	m[1210] = "\\cyrchar\\CYRSHHA ";
-	m[1211] = "\\cyrchar\\cyrshha ";
-	m[1212] = "\\cyrchar\\CYRABHCH ";
-	m[1213] = "\\cyrchar\\cyrabhch ";
-	m[1214] = "\\cyrchar\\CYRABHCHDSC ";
-	m[1215] = "\\cyrchar\\cyrabhchdsc ";
-	m[1216] = "\\cyrchar\\CYRpalochka ";
-	m[1219] = "\\cyrchar\\CYRKHK ";
-	m[1220] = "\\cyrchar\\cyrkhk ";
-	m[1223] = "\\cyrchar\\CYRNHK ";
-	m[1224] = "\\cyrchar\\cyrnhk ";
-	m[1227] = "\\cyrchar\\CYRCHLDSC ";
-	m[1228] = "\\cyrchar\\cyrchldsc ";
-	m[1236] = "\\cyrchar\\CYRAE ";
-	m[1237] = "\\cyrchar\\cyrae ";
-	m[1240] = "\\cyrchar\\CYRSCHWA ";
-	m[1241] = "\\cyrchar\\cyrschwa ";
-	m[1248] = "\\cyrchar\\CYRABHDZE ";
-	m[1249] = "\\cyrchar\\cyrabhdze ";
-	m[1256] = "\\cyrchar\\CYROTLD ";
-	m[1257] = "\\cyrchar\\cyrotld ";
-	m[8194] = "\\hspace{0.6em}";
-	m[8195] = "\\hspace{1em}";
-	m[8196] = "\\hspace{0.33em}";
-	m[8197] = "\\hspace{0.25em}";
-	m[8198] = "\\hspace{0.166em}";
-	m[8199] = "\\hphantom{0}";
-	m[8200] = "\\hphantom{,}";
-	m[8201] = "\\hspace{0.167em}";
-	m[8201] = "\\;";
-	m[8202] = "\\mkern1mu ";
-	m[8211] = "\\textendash ";
-	m[8212] = "\\textemdash ";
-	m[8213] = "\\rule{1em}{1pt}";
-	m[8214] = "\\Vert ";
-	m[8219] = "\\Elzreapos ";
-	m[8220] = "\\textquotedblleft ";
-	m[8221] = "\\textquotedblright ";
-	m[8222] = ",";
-	m[8224] = "\\textdagger ";
-	m[8225] = "\\textdaggerdbl ";
-	m[8226] = "\\textbullet ";
-	m[8229] = "..";
-	m[8230] = "\\ldots ";
-	m[8240] = "\\textperthousand ";
-	m[8241] = "\\textpertenthousand ";
-	m[8242] = "{'}";
-	m[8243] = "{''}";
-	m[8244] = "{'''}";
-	m[8245] = "\\backprime ";
-	m[8249] = "\\guilsinglleft ";
-	m[8250] = "\\guilsinglright ";
-	m[8279] = "''''";
-	m[8287] = "\\mkern4mu ";
-	m[8288] = "\\nolinebreak ";
-	m[8359] = "\\ensuremath{\\Elzpes}";
-	m[8364] = "\\mbox{\\texteuro} ";
-	m[8411] = "\\dddot ";
-	m[8412] = "\\ddddot ";
-	m[8450] = "\\mathbb{C}";
-	m[8458] = "\\mathscr{g}";
-	m[8459] = "\\mathscr{H}";
-	m[8460] = "\\mathfrak{H}";
-	m[8461] = "\\mathbb{H}";
-	m[8463] = "\\hslash ";
-	m[8464] = "\\mathscr{I}";
-	m[8465] = "\\mathfrak{I}";
-	m[8466] = "\\mathscr{L}";
-	m[8467] = "\\mathscr{l}";
-	m[8469] = "\\mathbb{N}";
-	m[8470] = "\\cyrchar\\textnumero ";
-	m[8472] = "\\wp ";
-	m[8473] = "\\mathbb{P}";
-	m[8474] = "\\mathbb{Q}";
-	m[8475] = "\\mathscr{R}";
-	m[8476] = "\\mathfrak{R}";
-	m[8477] = "\\mathbb{R}";
-	m[8478] = "\\Elzxrat ";
-	m[8482] = "\\texttrademark ";
-	m[8484] = "\\mathbb{Z}";
-	m[8486] = "\\Omega ";
-	m[8487] = "\\mho ";
-	m[8488] = "\\mathfrak{Z}";
-	m[8489] = "\\ElsevierGlyph{2129}";
-	m[8491] = "\\AA ";
-	m[8492] = "\\mathscr{B}";
-	m[8493] = "\\mathfrak{C}";
-	m[8495] = "\\mathscr{e}";
-	m[8496] = "\\mathscr{E}";
-	m[8497] = "\\mathscr{F}";
-	m[8499] = "\\mathscr{M}";
-	m[8500] = "\\mathscr{o}";
-	m[8501] = "\\aleph ";
-	m[8502] = "\\beth ";
-	m[8503] = "\\gimel ";
-	m[8504] = "\\daleth ";
-	m[8531] = "\\textfrac{1}{3}";
-	m[8532] = "\\textfrac{2}{3}";
-	m[8533] = "\\textfrac{1}{5}";
-	m[8534] = "\\textfrac{2}{5}";
-	m[8535] = "\\textfrac{3}{5}";
-	m[8536] = "\\textfrac{4}{5}";
-	m[8537] = "\\textfrac{1}{6}";
-	m[8538] = "\\textfrac{5}{6}";
-	m[8539] = "\\textfrac{1}{8}";
-	m[8540] = "\\textfrac{3}{8}";
-	m[8541] = "\\textfrac{5}{8}";
-	m[8542] = "\\textfrac{7}{8}";
-	m[8592] = "\\leftarrow ";
-	m[8593] = "\\uparrow ";
-	m[8594] = "\\rightarrow ";
-	m[8595] = "\\downarrow ";
-	m[8596] = "\\leftrightarrow ";
-	m[8597] = "\\updownarrow ";
-	m[8598] = "\\nwarrow ";
-	m[8599] = "\\nearrow ";
-	m[8600] = "\\searrow ";
-	m[8601] = "\\swarrow ";
-	m[8602] = "\\nleftarrow ";
-	m[8603] = "\\nrightarrow ";
-	m[8604] = "\\arrowwaveright ";
-	m[8605] = "\\arrowwaveright ";
-	m[8606] = "\\twoheadleftarrow ";
-	m[8608] = "\\twoheadrightarrow ";
-	m[8610] = "\\leftarrowtail ";
-	m[8611] = "\\rightarrowtail ";
-	m[8614] = "\\mapsto ";
-	m[8617] = "\\hookleftarrow ";
-	m[8618] = "\\hookrightarrow ";
-	m[8619] = "\\looparrowleft ";
-	m[8620] = "\\looparrowright ";
-	m[8621] = "\\leftrightsquigarrow ";
-	m[8622] = "\\nleftrightarrow ";
-	m[8624] = "\\Lsh ";
-	m[8625] = "\\Rsh ";
-	m[8627] = "\\ElsevierGlyph{21B3}";
-	m[8630] = "\\curvearrowleft ";
-	m[8631] = "\\curvearrowright ";
-	m[8634] = "\\circlearrowleft ";
-	m[8635] = "\\circlearrowright ";
-	m[8636] = "\\leftharpoonup ";
-	m[8637] = "\\leftharpoondown ";
-	m[8638] = "\\upharpoonright ";
-	m[8639] = "\\upharpoonleft ";
-	m[8640] = "\\rightharpoonup ";
-	m[8641] = "\\rightharpoondown ";
-	m[8642] = "\\downharpoonright ";
-	m[8643] = "\\downharpoonleft ";
-	m[8644] = "\\rightleftarrows ";
-	m[8645] = "\\dblarrowupdown ";
-	m[8646] = "\\leftrightarrows ";
-	m[8647] = "\\leftleftarrows ";
-	m[8648] = "\\upuparrows ";
-	m[8649] = "\\rightrightarrows ";
-	m[8650] = "\\downdownarrows ";
-	m[8651] = "\\leftrightharpoons ";
-	m[8652] = "\\rightleftharpoons ";
-	m[8653] = "\\nLeftarrow ";
-	m[8654] = "\\nLeftrightarrow ";
-	m[8655] = "\\nRightarrow ";
-	m[8656] = "\\Leftarrow ";
-	m[8657] = "\\Uparrow ";
-	m[8658] = "\\Rightarrow ";
-	m[8659] = "\\Downarrow ";
-	m[8660] = "\\Leftrightarrow ";
-	m[8661] = "\\Updownarrow ";
-	m[8666] = "\\Lleftarrow ";
-	m[8667] = "\\Rrightarrow ";
-	m[8669] = "\\rightsquigarrow ";
-	m[8693] = "\\DownArrowUpArrow ";
-	m[8704] = "\\forall ";
-	m[8705] = "\\complement ";
-	m[8706] = "\\partial ";
-	m[8707] = "\\exists ";
-	m[8708] = "\\nexists ";
-	m[8709] = "\\varnothing ";
-	m[8711] = "\\nabla ";
-	m[8712] = "\\in ";
-	m[8713] = "\\not\\in ";
-	m[8715] = "\\ni ";
-	m[8716] = "\\not\\ni ";
-	m[8719] = "\\prod ";
-	m[8720] = "\\coprod ";
-	m[8721] = "\\sum ";
-	m[8723] = "\\mp ";
-	m[8724] = "\\dotplus ";
-	m[8726] = "\\setminus ";
-	m[8727] = "{_\\ast}";
-	m[8728] = "\\circ ";
-	m[8729] = "\\bullet ";
-	m[8730] = "\\surd ";
-	m[8733] = "\\propto ";
-	m[8734] = "\\infty ";
-	m[8735] = "\\rightangle ";
-	m[8736] = "\\angle ";
-	m[8737] = "\\measuredangle ";
-	m[8738] = "\\sphericalangle ";
-	m[8739] = "\\mid ";
-	m[8740] = "\\nmid ";
-	m[8741] = "\\parallel ";
-	m[8742] = "\\nparallel ";
-	m[8743] = "\\wedge ";
-	m[8744] = "\\vee ";
-	m[8745] = "\\cap ";
-	m[8746] = "\\cup ";
-	m[8747] = "\\int ";
-	m[8748] = "\\int\\!\\int ";
-	m[8749] = "\\int\\!\\int\\!\\int ";
-	m[8750] = "\\oint ";
-	m[8751] = "\\surfintegral ";
-	m[8752] = "\\volintegral ";
-	m[8753] = "\\clwintegral ";
-	m[8754] = "\\ElsevierGlyph{2232}";
-	m[8755] = "\\ElsevierGlyph{2233}";
-	m[8756] = "\\therefore ";
-	m[8757] = "\\because ";
-	m[8759] = "\\Colon ";
-	m[8760] = "\\ElsevierGlyph{2238}";
-	m[8762] = "\\mathbin{{:}\\!\\!{-}\\!\\!{:}}";
-	m[8763] = "\\homothetic ";
-	m[8764] = "\\sim ";
-	m[8765] = "\\backsim ";
-	m[8766] = "\\lazysinv ";
-	m[8768] = "\\wr ";
-	m[8769] = "\\not\\sim ";
-	m[8770] = "\\ElsevierGlyph{2242}";
-	m[8770] = "\\NotEqualTilde ";
-	m[8771] = "\\simeq ";
-	m[8772] = "\\not\\simeq ";
-	m[8773] = "\\cong ";
-	m[8774] = "\\approxnotequal ";
-	m[8775] = "\\not\\cong ";
-	m[8776] = "\\approx ";
-	m[8777] = "\\not\\approx ";
-	m[8778] = "\\approxeq ";
-	m[8779] = "\\tildetrpl ";
-	m[8779] = "\\not\\apid ";
-	m[8780] = "\\allequal ";
-	m[8781] = "\\asymp ";
-	m[8782] = "\\Bumpeq ";
-	m[8782] = "\\NotHumpDownHump ";
-	m[8783] = "\\bumpeq ";
-	m[8783] = "\\NotHumpEqual ";
-	m[8784] = "\\doteq ";
-	m[8784] = "\\not\\doteq";
-	m[8785] = "\\doteqdot ";
-	m[8786] = "\\fallingdotseq ";
-	m[8787] = "\\risingdotseq ";
-	m[8788] = ":=";
-	m[8789] = "=:";
-	m[8790] = "\\eqcirc ";
-	m[8791] = "\\circeq ";
-	m[8793] = "\\estimates ";
-	m[8794] = "\\ElsevierGlyph{225A}";
-	m[8795] = "\\starequal ";
-	m[8796] = "\\triangleq ";
-	m[8799] = "\\ElsevierGlyph{225F}";
-	m[8800] = "\\not =";
-	m[8801] = "\\equiv ";
-	m[8802] = "\\not\\equiv ";
-	m[8804] = "\\leq ";
-	m[8805] = "\\geq ";
-	m[8806] = "\\leqq ";
-	m[8807] = "\\geqq ";
-	m[8808] = "\\lneqq ";
-	m[8808] = "\\lvertneqq ";
-	m[8809] = "\\gneqq ";
-	m[8809] = "\\gvertneqq ";
-	m[8810] = "\\ll ";
-	m[8810] = "\\NotLessLess ";
-	m[8811] = "\\gg ";
-	m[8811] = "\\NotGreaterGreater ";
-	m[8812] = "\\between ";
-	m[8813] = "\\not\\kern-0.3em\\times ";
-	m[8814] = "\\not&lt;";
-	m[8815] = "\\not&gt;";
-	m[8816] = "\\not\\leq ";
-	m[8817] = "\\not\\geq ";
-	m[8818] = "\\lessequivlnt ";
-	m[8819] = "\\greaterequivlnt ";
-	m[8820] = "\\ElsevierGlyph{2274}";
-	m[8821] = "\\ElsevierGlyph{2275}";
-	m[8822] = "\\lessgtr ";
-	m[8823] = "\\gtrless ";
-	m[8824] = "\\notlessgreater ";
-	m[8825] = "\\notgreaterless ";
-	m[8826] = "\\prec ";
-	m[8827] = "\\succ ";
-	m[8828] = "\\preccurlyeq ";
-	m[8829] = "\\succcurlyeq ";
-	m[8830] = "\\precapprox ";
-	m[8830] = "\\NotPrecedesTilde ";
-	m[8831] = "\\succapprox ";
-	m[8831] = "\\NotSucceedsTilde ";
-	m[8832] = "\\not\\prec ";
-	m[8833] = "\\not\\succ ";
-	m[8834] = "\\subset ";
-	m[8835] = "\\supset ";
-	m[8836] = "\\not\\subset ";
-	m[8837] = "\\not\\supset ";
-	m[8838] = "\\subseteq ";
-	m[8839] = "\\supseteq ";
-	m[8840] = "\\not\\subseteq ";
-	m[8841] = "\\not\\supseteq ";
-	m[8842] = "\\subsetneq ";
-	m[8842] = "\\varsubsetneqq ";
-	m[8843] = "\\supsetneq ";
-	m[8843] = "\\varsupsetneq ";
-	m[8846] = "\\uplus ";
-	m[8847] = "\\sqsubset ";
-	m[8847] = "\\NotSquareSubset ";
-	m[8848] = "\\sqsupset ";
-	m[8848] = "\\NotSquareSuperset ";
-	m[8849] = "\\sqsubseteq ";
-	m[8850] = "\\sqsupseteq ";
-	m[8851] = "\\sqcap ";
-	m[8852] = "\\sqcup ";
-	m[8853] = "\\oplus ";
-	m[8854] = "\\ominus ";
-	m[8855] = "\\otimes ";
-	m[8856] = "\\oslash ";
-	m[8857] = "\\odot ";
-	m[8858] = "\\circledcirc ";
-	m[8859] = "\\circledast ";
-	m[8861] = "\\circleddash ";
-	m[8862] = "\\boxplus ";
-	m[8863] = "\\boxminus ";
-	m[8864] = "\\boxtimes ";
-	m[8865] = "\\boxdot ";
-	m[8866] = "\\vdash ";
-	m[8867] = "\\dashv ";
-	m[8868] = "\\top ";
-	m[8869] = "\\perp ";
-	m[8871] = "\\truestate ";
-	m[8872] = "\\forcesextra ";
-	m[8873] = "\\Vdash ";
-	m[8874] = "\\Vvdash ";
-	m[8875] = "\\VDash ";
-	m[8876] = "\\nvdash ";
-	m[8877] = "\\nvDash ";
-	m[8878] = "\\nVdash ";
-	m[8879] = "\\nVDash ";
-	m[8882] = "\\vartriangleleft ";
-	m[8883] = "\\vartriangleright ";
-	m[8884] = "\\trianglelefteq ";
-	m[8885] = "\\trianglerighteq ";
-	m[8886] = "\\original ";
-	m[8887] = "\\image ";
-	m[8888] = "\\multimap ";
-	m[8889] = "\\hermitconjmatrix ";
-	m[8890] = "\\intercal ";
-	m[8891] = "\\veebar ";
-	m[8894] = "\\rightanglearc ";
-	m[8896] = "\\ElsevierGlyph{22C0}";
-	m[8897] = "\\ElsevierGlyph{22C1}";
-	m[8898] = "\\bigcap ";
-	m[8899] = "\\bigcup ";
-	m[8900] = "\\diamond ";
-	m[8901] = "\\cdot ";
-	m[8902] = "\\star ";
-	m[8903] = "\\divideontimes ";
-	m[8904] = "\\bowtie ";
-	m[8905] = "\\ltimes ";
-	m[8906] = "\\rtimes ";
-	m[8907] = "\\leftthreetimes ";
-	m[8908] = "\\rightthreetimes ";
-	m[8909] = "\\backsimeq ";
-	m[8910] = "\\curlyvee ";
-	m[8911] = "\\curlywedge ";
-	m[8912] = "\\Subset ";
-	m[8913] = "\\Supset ";
-	m[8914] = "\\Cap ";
-	m[8915] = "\\Cup ";
-	m[8916] = "\\pitchfork ";
-	m[8918] = "\\lessdot ";
-	m[8919] = "\\gtrdot ";
-	m[8920] = "\\verymuchless ";
-	m[8921] = "\\verymuchgreater ";
-	m[8922] = "\\lesseqgtr ";
-	m[8923] = "\\gtreqless ";
-	m[8926] = "\\curlyeqprec ";
-	m[8927] = "\\curlyeqsucc ";
-	m[8930] = "\\not\\sqsubseteq ";
-	m[8931] = "\\not\\sqsupseteq ";
-	m[8933] = "\\Elzsqspne ";
-	m[8934] = "\\lnsim ";
-	m[8935] = "\\gnsim ";
-	m[8936] = "\\precedesnotsimilar ";
-	m[8937] = "\\succnsim ";
-	m[8938] = "\\ntriangleleft ";
-	m[8939] = "\\ntriangleright ";
-	m[8940] = "\\ntrianglelefteq ";
-	m[8941] = "\\ntrianglerighteq ";
-	m[8942] = "\\vdots ";
-	m[8943] = "\\cdots ";
-	m[8944] = "\\upslopeellipsis ";
-	m[8945] = "\\downslopeellipsis ";
-	m[8965] = "\\barwedge ";
-	m[8966] = "\\perspcorrespond ";
-	m[8968] = "\\lceil ";
-	m[8969] = "\\rceil ";
-	m[8970] = "\\lfloor ";
-	m[8971] = "\\rfloor ";
-	m[8981] = "\\recorder ";
-	m[8982] = "\\mathchar\"2208";
-	m[8988] = "\\ulcorner ";
-	m[8989] = "\\urcorner ";
-	m[8990] = "\\llcorner ";
-	m[8991] = "\\lrcorner ";
-	m[8994] = "\\frown ";
-	m[8995] = "\\smile ";
-	m[9001] = "\\langle ";
-	m[9002] = "\\rangle ";
-	m[9021] = "\\ElsevierGlyph{E838}";
-	m[9123] = "\\Elzdlcorn ";
-	m[9136] = "\\lmoustache ";
-	m[9137] = "\\rmoustache ";
-	m[9251] = "\\textvisiblespace ";
-	m[9312] = "\\ding{172}";
-	m[9313] = "\\ding{173}";
-	m[9314] = "\\ding{174}";
-	m[9315] = "\\ding{175}";
-	m[9316] = "\\ding{176}";
-	m[9317] = "\\ding{177}";
-	m[9318] = "\\ding{178}";
-	m[9319] = "\\ding{179}";
-	m[9320] = "\\ding{180}";
-	m[9321] = "\\ding{181}";
-	m[9416] = "\\circledS ";
-	m[9478] = "\\Elzdshfnc ";
-	m[9497] = "\\Elzsqfnw ";
-	m[9585] = "\\diagup ";
-	m[9632] = "\\ding{110}";
-	m[9633] = "\\square ";
-	m[9642] = "\\blacksquare ";
-	m[9645] = "\\fbox{~~}";
-	m[9647] = "\\Elzvrecto ";
-	m[9649] = "\\ElsevierGlyph{E381}";
-	m[9650] = "\\ding{115}";
-	m[9651] = "\\bigtriangleup ";
-	m[9652] = "\\blacktriangle ";
-	m[9653] = "\\vartriangle ";
-	m[9656] = "\\blacktriangleright ";
-	m[9657] = "\\triangleright ";
-	m[9660] = "\\ding{116}";
-	m[9661] = "\\bigtriangledown ";
-	m[9662] = "\\blacktriangledown ";
-	m[9663] = "\\triangledown ";
-	m[9666] = "\\blacktriangleleft ";
-	m[9667] = "\\triangleleft ";
-	m[9670] = "\\ding{117}";
-	m[9674] = "\\lozenge ";
-	m[9675] = "\\bigcirc ";
-	m[9679] = "\\ding{108}";
-	m[9680] = "\\Elzcirfl ";
-	m[9681] = "\\Elzcirfr ";
-	m[9682] = "\\Elzcirfb ";
-	m[9687] = "\\ding{119}";
-	m[9688] = "\\Elzrvbull ";
-	m[9703] = "\\Elzsqfl ";
-	m[9704] = "\\Elzsqfr ";
-	m[9706] = "\\Elzsqfse ";
-	m[9711] = "\\bigcirc ";
-	m[9733] = "\\ding{72}";
-	m[9734] = "\\ding{73}";
-	m[9742] = "\\ding{37}";
-	m[9755] = "\\ding{42}";
-	m[9758] = "\\ding{43}";
-	m[9790] = "\\rightmoon ";
-	m[9791] = "\\mercury ";
-	m[9792] = "\\venus ";
-	m[9794] = "\\male ";
-	m[9795] = "\\jupiter ";
-	m[9796] = "\\saturn ";
-	m[9797] = "\\uranus ";
-	m[9798] = "\\neptune ";
-	m[9799] = "\\pluto ";
-	m[9800] = "\\aries ";
-	m[9801] = "\\taurus ";
-	m[9802] = "\\gemini ";
-	m[9803] = "\\cancer ";
-	m[9804] = "\\leo ";
-	m[9805] = "\\virgo ";
-	m[9806] = "\\libra ";
-	m[9807] = "\\scorpio ";
-	m[9808] = "\\sagittarius ";
-	m[9809] = "\\capricornus ";
-	m[9810] = "\\aquarius ";
-	m[9811] = "\\pisces ";
-	m[9824] = "\\ding{171}";
-	m[9826] = "\\diamond ";
-	m[9827] = "\\ding{168}";
-	m[9829] = "\\ding{170}";
-	m[9830] = "\\ding{169}";
-	m[9833] = "\\quarternote ";
-	m[9834] = "\\eighthnote ";
-	m[9837] = "\\flat ";
-	m[9838] = "\\natural ";
-	m[9839] = "\\sharp ";
-	m[9985] = "\\ding{33}";
-	m[9986] = "\\ding{34}";
-	m[9987] = "\\ding{35}";
-	m[9988] = "\\ding{36}";
-	m[9990] = "\\ding{38}";
-	m[9991] = "\\ding{39}";
-	m[9992] = "\\ding{40}";
-	m[9993] = "\\ding{41}";
-	m[9996] = "\\ding{44}";
-	m[9997] = "\\ding{45}";
-	m[9998] = "\\ding{46}";
-	m[9999] = "\\ding{47}";
-	m[10000] = "\\ding{48}";
-	m[10001] = "\\ding{49}";
-	m[10002] = "\\ding{50}";
-	m[10003] = "\\ding{51}";
-	m[10004] = "\\ding{52}";
-	m[10005] = "\\ding{53}";
-	m[10006] = "\\ding{54}";
-	m[10007] = "\\ding{55}";
-	m[10008] = "\\ding{56}";
-	m[10009] = "\\ding{57}";
-	m[10010] = "\\ding{58}";
-	m[10011] = "\\ding{59}";
-	m[10012] = "\\ding{60}";
-	m[10013] = "\\ding{61}";
-	m[10014] = "\\ding{62}";
-	m[10015] = "\\ding{63}";
-	m[10016] = "\\ding{64}";
-	m[10017] = "\\ding{65}";
-	m[10018] = "\\ding{66}";
-	m[10019] = "\\ding{67}";
-	m[10020] = "\\ding{68}";
-	m[10021] = "\\ding{69}";
-	m[10022] = "\\ding{70}";
-	m[10023] = "\\ding{71}";
-	m[10025] = "\\ding{73}";
-	m[10026] = "\\ding{74}";
-	m[10027] = "\\ding{75}";
-	m[10028] = "\\ding{76}";
-	m[10029] = "\\ding{77}";
-	m[10030] = "\\ding{78}";
-	m[10031] = "\\ding{79}";
-	m[10032] = "\\ding{80}";
-	m[10033] = "\\ding{81}";
-	m[10034] = "\\ding{82}";
-	m[10035] = "\\ding{83}";
-	m[10036] = "\\ding{84}";
-	m[10037] = "\\ding{85}";
-	m[10038] = "\\ding{86}";
-	m[10039] = "\\ding{87}";
-	m[10040] = "\\ding{88}";
-	m[10041] = "\\ding{89}";
-	m[10042] = "\\ding{90}";
-	m[10043] = "\\ding{91}";
-	m[10044] = "\\ding{92}";
-	m[10045] = "\\ding{93}";
-	m[10046] = "\\ding{94}";
-	m[10047] = "\\ding{95}";
-	m[10048] = "\\ding{96}";
-	m[10049] = "\\ding{97}";
-	m[10050] = "\\ding{98}";
-	m[10051] = "\\ding{99}";
-	m[10052] = "\\ding{100}";
-	m[10053] = "\\ding{101}";
-	m[10054] = "\\ding{102}";
-	m[10055] = "\\ding{103}";
-	m[10056] = "\\ding{104}";
-	m[10057] = "\\ding{105}";
-	m[10058] = "\\ding{106}";
-	m[10059] = "\\ding{107}";
-	m[10061] = "\\ding{109}";
-	m[10063] = "\\ding{111}";
-	m[10064] = "\\ding{112}";
-	m[10065] = "\\ding{113}";
-	m[10066] = "\\ding{114}";
-	m[10070] = "\\ding{118}";
-	m[10072] = "\\ding{120}";
-	m[10073] = "\\ding{121}";
-	m[10074] = "\\ding{122}";
-	m[10075] = "\\ding{123}";
-	m[10076] = "\\ding{124}";
-	m[10077] = "\\ding{125}";
-	m[10078] = "\\ding{126}";
-	m[10081] = "\\ding{161}";
-	m[10082] = "\\ding{162}";
-	m[10083] = "\\ding{163}";
-	m[10084] = "\\ding{164}";
-	m[10085] = "\\ding{165}";
-	m[10086] = "\\ding{166}";
-	m[10087] = "\\ding{167}";
-	m[10102] = "\\ding{182}";
-	m[10103] = "\\ding{183}";
-	m[10104] = "\\ding{184}";
-	m[10105] = "\\ding{185}";
-	m[10106] = "\\ding{186}";
-	m[10107] = "\\ding{187}";
-	m[10108] = "\\ding{188}";
-	m[10109] = "\\ding{189}";
-	m[10110] = "\\ding{190}";
-	m[10111] = "\\ding{191}";
-	m[10112] = "\\ding{192}";
-	m[10113] = "\\ding{193}";
-	m[10114] = "\\ding{194}";
-	m[10115] = "\\ding{195}";
-	m[10116] = "\\ding{196}";
-	m[10117] = "\\ding{197}";
-	m[10118] = "\\ding{198}";
-	m[10119] = "\\ding{199}";
-	m[10120] = "\\ding{200}";
-	m[10121] = "\\ding{201}";
-	m[10122] = "\\ding{202}";
-	m[10123] = "\\ding{203}";
-	m[10124] = "\\ding{204}";
-	m[10125] = "\\ding{205}";
-	m[10126] = "\\ding{206}";
-	m[10127] = "\\ding{207}";
-	m[10128] = "\\ding{208}";
-	m[10129] = "\\ding{209}";
-	m[10130] = "\\ding{210}";
-	m[10131] = "\\ding{211}";
-	m[10132] = "\\ding{212}";
-	m[10136] = "\\ding{216}";
-	m[10137] = "\\ding{217}";
-	m[10138] = "\\ding{218}";
-	m[10139] = "\\ding{219}";
-	m[10140] = "\\ding{220}";
-	m[10141] = "\\ding{221}";
-	m[10142] = "\\ding{222}";
-	m[10143] = "\\ding{223}";
-	m[10144] = "\\ding{224}";
-	m[10145] = "\\ding{225}";
-	m[10146] = "\\ding{226}";
-	m[10147] = "\\ding{227}";
-	m[10148] = "\\ding{228}";
-	m[10149] = "\\ding{229}";
-	m[10150] = "\\ding{230}";
-	m[10151] = "\\ding{231}";
-	m[10152] = "\\ding{232}";
-	m[10153] = "\\ding{233}";
-	m[10154] = "\\ding{234}";
-	m[10155] = "\\ding{235}";
-	m[10156] = "\\ding{236}";
-	m[10157] = "\\ding{237}";
-	m[10158] = "\\ding{238}";
-	m[10159] = "\\ding{239}";
-	m[10161] = "\\ding{241}";
-	m[10162] = "\\ding{242}";
-	m[10163] = "\\ding{243}";
-	m[10164] = "\\ding{244}";
-	m[10165] = "\\ding{245}";
-	m[10166] = "\\ding{246}";
-	m[10167] = "\\ding{247}";
-	m[10168] = "\\ding{248}";
-	m[10169] = "\\ding{249}";
-	m[10170] = "\\ding{250}";
-	m[10171] = "\\ding{251}";
-	m[10172] = "\\ding{252}";
-	m[10173] = "\\ding{253}";
-	m[10174] = "\\ding{254}";
-	m[10229] = "\\longleftarrow ";
-	m[10230] = "\\longrightarrow ";
-	m[10231] = "\\longleftrightarrow ";
-	m[10232] = "\\Longleftarrow ";
-	m[10233] = "\\Longrightarrow ";
-	m[10234] = "\\Longleftrightarrow ";
-	m[10236] = "\\longmapsto ";
-	m[10239] = "\\sim\\joinrel\\leadsto";
-	m[10501] = "\\ElsevierGlyph{E212}";
-	m[10514] = "\\UpArrowBar ";
-	m[10515] = "\\DownArrowBar ";
-	m[10531] = "\\ElsevierGlyph{E20C}";
-	m[10532] = "\\ElsevierGlyph{E20D}";
-	m[10533] = "\\ElsevierGlyph{E20B}";
-	m[10534] = "\\ElsevierGlyph{E20A}";
-	m[10535] = "\\ElsevierGlyph{E211}";
-	m[10536] = "\\ElsevierGlyph{E20E}";
-	m[10537] = "\\ElsevierGlyph{E20F}";
-	m[10538] = "\\ElsevierGlyph{E210}";
-	m[10547] = "\\ElsevierGlyph{E21C}";
-	m[10547] = "\\ElsevierGlyph{E21D}";
-	m[10550] = "\\ElsevierGlyph{E21A}";
-	m[10551] = "\\ElsevierGlyph{E219}";
-	m[10560] = "\\Elolarr ";
-	m[10561] = "\\Elorarr ";
-	m[10562] = "\\ElzRlarr ";
-	m[10564] = "\\ElzrLarr ";
-	m[10567] = "\\Elzrarrx ";
-	m[10574] = "\\LeftRightVector ";
-	m[10575] = "\\RightUpDownVector ";
-	m[10576] = "\\DownLeftRightVector ";
-	m[10577] = "\\LeftUpDownVector ";
-	m[10578] = "\\LeftVectorBar ";
-	m[10579] = "\\RightVectorBar ";
-	m[10580] = "\\RightUpVectorBar ";
-	m[10581] = "\\RightDownVectorBar ";
-	m[10582] = "\\DownLeftVectorBar ";
-	m[10583] = "\\DownRightVectorBar ";
-	m[10584] = "\\LeftUpVectorBar ";
-	m[10585] = "\\LeftDownVectorBar ";
-	m[10586] = "\\LeftTeeVector ";
-	m[10587] = "\\RightTeeVector ";
-	m[10588] = "\\RightUpTeeVector ";
-	m[10589] = "\\RightDownTeeVector ";
-	m[10590] = "\\DownLeftTeeVector ";
-	m[10591] = "\\DownRightTeeVector ";
-	m[10592] = "\\LeftUpTeeVector ";
-	m[10593] = "\\LeftDownTeeVector ";
-	m[10606] = "\\UpEquilibrium ";
-	m[10607] = "\\ReverseUpEquilibrium ";
-	m[10608] = "\\RoundImplies ";
-	m[10620] = "\\ElsevierGlyph{E214}";
-	m[10621] = "\\ElsevierGlyph{E215}";
-	m[10624] = "\\Elztfnc ";
-	m[10629] = "\\ElsevierGlyph{3018}";
-	m[10630] = "\\Elroang ";
-	m[10643] = "&lt;\\kern-0.58em(";
-	m[10644] = "\\ElsevierGlyph{E291}";
-	m[10649] = "\\Elzddfnc ";
-	m[10652] = "\\Angle ";
-	m[10656] = "\\Elzlpargt ";
-	m[10677] = "\\ElsevierGlyph{E260}";
-	m[10678] = "\\ElsevierGlyph{E61B}";
-	m[10698] = "\\ElzLap ";
-	m[10699] = "\\Elzdefas ";
-	m[10703] = "\\LeftTriangleBar ";
-	m[10703] = "\\NotLeftTriangleBar ";
-	m[10704] = "\\RightTriangleBar ";
-	m[10704] = "\\NotRightTriangleBar ";
-	m[10716] = "\\ElsevierGlyph{E372}";
-	m[10731] = "\\blacklozenge ";
-	m[10740] = "\\RuleDelayed ";
-	m[10756] = "\\Elxuplus ";
-	m[10757] = "\\ElzThr ";
-	m[10758] = "\\Elxsqcup ";
-	m[10759] = "\\ElzInf ";
-	m[10760] = "\\ElzSup ";
-	m[10765] = "\\ElzCint ";
-	m[10767] = "\\clockoint ";
-	m[10768] = "\\ElsevierGlyph{E395}";
-	m[10774] = "\\sqrint ";
-	m[10789] = "\\ElsevierGlyph{E25A}";
-	m[10794] = "\\ElsevierGlyph{E25B}";
-	m[10797] = "\\ElsevierGlyph{E25C}";
-	m[10798] = "\\ElsevierGlyph{E25D}";
-	m[10799] = "\\ElzTimes ";
-	m[10804] = "\\ElsevierGlyph{E25E}";
-	m[10805] = "\\ElsevierGlyph{E25E}";
-	m[10812] = "\\ElsevierGlyph{E259}";
-	m[10815] = "\\amalg ";
-	m[10835] = "\\ElzAnd ";
-	m[10836] = "\\ElzOr ";
-	m[10837] = "\\ElsevierGlyph{E36E}";
-	m[10838] = "\\ElOr ";
-	m[10846] = "\\perspcorrespond ";
-	m[10847] = "\\Elzminhat ";
-	m[10851] = "\\ElsevierGlyph{225A}";
-	m[10862] = "\\stackrel{*}{=}";
-	m[10869] = "\\Equal ";
-	m[10877] = "\\leqslant ";
-	m[10877] = "\\nleqslant ";
-	m[10878] = "\\geqslant ";
-	m[10878] = "\\ngeqslant ";
-	m[10885] = "\\lessapprox ";
-	m[10886] = "\\gtrapprox ";
-	m[10887] = "\\lneq ";
-	m[10888] = "\\gneq ";
-	m[10889] = "\\lnapprox ";
-	m[10890] = "\\gnapprox ";
-	m[10891] = "\\lesseqqgtr ";
-	m[10892] = "\\gtreqqless ";
-	m[10901] = "\\eqslantless ";
-	m[10902] = "\\eqslantgtr ";
-	m[10909] = "\\Pisymbol{ppi020}{117}";
-	m[10910] = "\\Pisymbol{ppi020}{105}";
-	m[10913] = "\\NestedLessLess ";
-	m[10913] = "\\NotNestedLessLess ";
-	m[10914] = "\\NestedGreaterGreater ";
-	m[10914] = "\\NotNestedGreaterGreater ";
-	m[10927] = "\\preceq ";
-	m[10927] = "\\not\\preceq ";
-	m[10928] = "\\succeq ";
-	m[10928] = "\\not\\succeq ";
-	m[10933] = "\\precneqq ";
-	m[10934] = "\\succneqq ";
-	m[10935] = "\\precapprox ";
-	m[10936] = "\\succapprox ";
-	m[10937] = "\\precnapprox ";
-	m[10938] = "\\succnapprox ";
-	m[10949] = "\\subseteqq ";
-	m[10949] = "\\nsubseteqq ";
-	m[10950] = "\\supseteqq ";
-	m[10950] = "\\nsupseteqq";
-	m[10955] = "\\subsetneqq ";
-	m[10956] = "\\supsetneqq ";
-	m[10987] = "\\ElsevierGlyph{E30D}";
-	m[10998] = "\\Elztdcol ";
-	m[11005] = "{{/}\\!\\!{/}}";
-	m[11005] = "{\\rlap{\\textbackslash}{{/}\\!\\!{/}}}";
-	m[12298] = "\\ElsevierGlyph{300A}";
-	m[12299] = "\\ElsevierGlyph{300B}";
-	m[12312] = "\\ElsevierGlyph{3018}";
-	m[12313] = "\\ElsevierGlyph{3019}";
-	m[12314] = "\\openbracketleft ";
-	m[12315] = "\\openbracketright ";
-	m[64256] = "ff";
-	m[64257] = "fi";
-	m[64258] = "fl";
-	m[64259] = "ffi";
-	m[64260] = "ffl";
-	m[54272] = "\\mathbf{A}";
-	m[54273] = "\\mathbf{B}";
-	m[54274] = "\\mathbf{C}";
-	m[54275] = "\\mathbf{D}";
-	m[54276] = "\\mathbf{E}";
-	m[54277] = "\\mathbf{F}";
-	m[54278] = "\\mathbf{G}";
-	m[54279] = "\\mathbf{H}";
-	m[54280] = "\\mathbf{I}";
-	m[54281] = "\\mathbf{J}";
-	m[54282] = "\\mathbf{K}";
-	m[54283] = "\\mathbf{L}";
-	m[54284] = "\\mathbf{M}";
-	m[54285] = "\\mathbf{N}";
-	m[54286] = "\\mathbf{O}";
-	m[54287] = "\\mathbf{P}";
-	m[54288] = "\\mathbf{Q}";
-	m[54289] = "\\mathbf{R}";
-	m[54290] = "\\mathbf{S}";
-	m[54291] = "\\mathbf{T}";
-	m[54292] = "\\mathbf{U}";
-	m[54293] = "\\mathbf{V}";
-	m[54294] = "\\mathbf{W}";
-	m[54295] = "\\mathbf{X}";
-	m[54296] = "\\mathbf{Y}";
-	m[54297] = "\\mathbf{Z}";
-	m[54298] = "\\mathbf{a}";
-	m[54299] = "\\mathbf{b}";
-	m[54300] = "\\mathbf{c}";
-	m[54301] = "\\mathbf{d}";
-	m[54302] = "\\mathbf{e}";
-	m[54303] = "\\mathbf{f}";
-	m[54304] = "\\mathbf{g}";
-	m[54305] = "\\mathbf{h}";
-	m[54306] = "\\mathbf{i}";
-	m[54307] = "\\mathbf{j}";
-	m[54308] = "\\mathbf{k}";
-	m[54309] = "\\mathbf{l}";
-	m[54310] = "\\mathbf{m}";
-	m[54311] = "\\mathbf{n}";
-	m[54312] = "\\mathbf{o}";
-	m[54313] = "\\mathbf{p}";
-	m[54314] = "\\mathbf{q}";
-	m[54315] = "\\mathbf{r}";
-	m[54316] = "\\mathbf{s}";
-	m[54317] = "\\mathbf{t}";
-	m[54318] = "\\mathbf{u}";
-	m[54319] = "\\mathbf{v}";
-	m[54320] = "\\mathbf{w}";
-	m[54321] = "\\mathbf{x}";
-	m[54322] = "\\mathbf{y}";
-	m[54323] = "\\mathbf{z}";
-	m[54324] = "\\mathsl{A}";
-	m[54325] = "\\mathsl{B}";
-	m[54326] = "\\mathsl{C}";
-	m[54327] = "\\mathsl{D}";
-	m[54328] = "\\mathsl{E}";
-	m[54329] = "\\mathsl{F}";
-	m[54330] = "\\mathsl{G}";
-	m[54331] = "\\mathsl{H}";
-	m[54332] = "\\mathsl{I}";
-	m[54333] = "\\mathsl{J}";
-	m[54334] = "\\mathsl{K}";
-	m[54335] = "\\mathsl{L}";
-	m[54336] = "\\mathsl{M}";
-	m[54337] = "\\mathsl{N}";
-	m[54338] = "\\mathsl{O}";
-	m[54339] = "\\mathsl{P}";
-	m[54340] = "\\mathsl{Q}";
-	m[54341] = "\\mathsl{R}";
-	m[54342] = "\\mathsl{S}";
-	m[54343] = "\\mathsl{T}";
-	m[54344] = "\\mathsl{U}";
-	m[54345] = "\\mathsl{V}";
-	m[54346] = "\\mathsl{W}";
-	m[54347] = "\\mathsl{X}";
-	m[54348] = "\\mathsl{Y}";
-	m[54349] = "\\mathsl{Z}";
-	m[54350] = "\\mathsl{a}";
-	m[54351] = "\\mathsl{b}";
-	m[54352] = "\\mathsl{c}";
-	m[54353] = "\\mathsl{d}";
-	m[54354] = "\\mathsl{e}";
-	m[54355] = "\\mathsl{f}";
-	m[54356] = "\\mathsl{g}";
-	m[54358] = "\\mathsl{i}";
-	m[54359] = "\\mathsl{j}";
-	m[54360] = "\\mathsl{k}";
-	m[54361] = "\\mathsl{l}";
-	m[54362] = "\\mathsl{m}";
-	m[54363] = "\\mathsl{n}";
-	m[54364] = "\\mathsl{o}";
-	m[54365] = "\\mathsl{p}";
-	m[54366] = "\\mathsl{q}";
-	m[54367] = "\\mathsl{r}";
-	m[54368] = "\\mathsl{s}";
-	m[54369] = "\\mathsl{t}";
-	m[54370] = "\\mathsl{u}";
-	m[54371] = "\\mathsl{v}";
-	m[54372] = "\\mathsl{w}";
-	m[54373] = "\\mathsl{x}";
-	m[54374] = "\\mathsl{y}";
-	m[54375] = "\\mathsl{z}";
-	m[54376] = "\\mathbit{A}";
-	m[54377] = "\\mathbit{B}";
-	m[54378] = "\\mathbit{C}";
-	m[54379] = "\\mathbit{D}";
-	m[54380] = "\\mathbit{E}";
-	m[54381] = "\\mathbit{F}";
-	m[54382] = "\\mathbit{G}";
-	m[54383] = "\\mathbit{H}";
-	m[54384] = "\\mathbit{I}";
-	m[54385] = "\\mathbit{J}";
-	m[54386] = "\\mathbit{K}";
-	m[54387] = "\\mathbit{L}";
-	m[54388] = "\\mathbit{M}";
-	m[54389] = "\\mathbit{N}";
-	m[54390] = "\\mathbit{O}";
-	m[54391] = "\\mathbit{P}";
-	m[54392] = "\\mathbit{Q}";
-	m[54393] = "\\mathbit{R}";
-	m[54394] = "\\mathbit{S}";
-	m[54395] = "\\mathbit{T}";
-	m[54396] = "\\mathbit{U}";
-	m[54397] = "\\mathbit{V}";
-	m[54398] = "\\mathbit{W}";
-	m[54399] = "\\mathbit{X}";
-	m[54400] = "\\mathbit{Y}";
-	m[54401] = "\\mathbit{Z}";
-	m[54402] = "\\mathbit{a}";
-	m[54403] = "\\mathbit{b}";
-	m[54404] = "\\mathbit{c}";
-	m[54405] = "\\mathbit{d}";
-	m[54406] = "\\mathbit{e}";
-	m[54407] = "\\mathbit{f}";
-	m[54408] = "\\mathbit{g}";
-	m[54409] = "\\mathbit{h}";
-	m[54410] = "\\mathbit{i}";
-	m[54411] = "\\mathbit{j}";
-	m[54412] = "\\mathbit{k}";
-	m[54413] = "\\mathbit{l}";
-	m[54414] = "\\mathbit{m}";
-	m[54415] = "\\mathbit{n}";
-	m[54416] = "\\mathbit{o}";
-	m[54417] = "\\mathbit{p}";
-	m[54418] = "\\mathbit{q}";
-	m[54419] = "\\mathbit{r}";
-	m[54420] = "\\mathbit{s}";
-	m[54421] = "\\mathbit{t}";
-	m[54422] = "\\mathbit{u}";
-	m[54423] = "\\mathbit{v}";
-	m[54424] = "\\mathbit{w}";
-	m[54425] = "\\mathbit{x}";
-	m[54426] = "\\mathbit{y}";
-	m[54427] = "\\mathbit{z}";
-	m[54428] = "\\mathscr{A}";
-	m[54430] = "\\mathscr{C}";
-	m[54431] = "\\mathscr{D}";
-	m[54434] = "\\mathscr{G}";
-	m[54437] = "\\mathscr{J}";
-	m[54438] = "\\mathscr{K}";
-	m[54441] = "\\mathscr{N}";
-	m[54442] = "\\mathscr{O}";
-	m[54443] = "\\mathscr{P}";
-	m[54444] = "\\mathscr{Q}";
-	m[54446] = "\\mathscr{S}";
-	m[54447] = "\\mathscr{T}";
-	m[54448] = "\\mathscr{U}";
-	m[54449] = "\\mathscr{V}";
-	m[54450] = "\\mathscr{W}";
-	m[54451] = "\\mathscr{X}";
-	m[54452] = "\\mathscr{Y}";
-	m[54453] = "\\mathscr{Z}";
-	m[54454] = "\\mathscr{a}";
-	m[54455] = "\\mathscr{b}";
-	m[54456] = "\\mathscr{c}";
-	m[54457] = "\\mathscr{d}";
-	m[54459] = "\\mathscr{f}";
-	m[54461] = "\\mathscr{h}";
-	m[54462] = "\\mathscr{i}";
-	m[54463] = "\\mathscr{j}";
-	m[54464] = "\\mathscr{k}";
-	m[54465] = "\\mathscr{l}";
-	m[54466] = "\\mathscr{m}";
-	m[54467] = "\\mathscr{n}";
-	m[54469] = "\\mathscr{p}";
-	m[54470] = "\\mathscr{q}";
-	m[54471] = "\\mathscr{r}";
-	m[54472] = "\\mathscr{s}";
-	m[54473] = "\\mathscr{t}";
-	m[54474] = "\\mathscr{u}";
-	m[54475] = "\\mathscr{v}";
-	m[54476] = "\\mathscr{w}";
-	m[54477] = "\\mathscr{x}";
-	m[54478] = "\\mathscr{y}";
-	m[54479] = "\\mathscr{z}";
-	m[54480] = "\\mathmit{A}";
-	m[54481] = "\\mathmit{B}";
-	m[54482] = "\\mathmit{C}";
-	m[54483] = "\\mathmit{D}";
-	m[54484] = "\\mathmit{E}";
-	m[54485] = "\\mathmit{F}";
-	m[54486] = "\\mathmit{G}";
-	m[54487] = "\\mathmit{H}";
-	m[54488] = "\\mathmit{I}";
-	m[54489] = "\\mathmit{J}";
-	m[54490] = "\\mathmit{K}";
-	m[54491] = "\\mathmit{L}";
-	m[54492] = "\\mathmit{M}";
-	m[54493] = "\\mathmit{N}";
-	m[54494] = "\\mathmit{O}";
-	m[54495] = "\\mathmit{P}";
-	m[54496] = "\\mathmit{Q}";
-	m[54497] = "\\mathmit{R}";
-	m[54498] = "\\mathmit{S}";
-	m[54499] = "\\mathmit{T}";
-	m[54500] = "\\mathmit{U}";
-	m[54501] = "\\mathmit{V}";
-	m[54502] = "\\mathmit{W}";
-	m[54503] = "\\mathmit{X}";
-	m[54504] = "\\mathmit{Y}";
-	m[54505] = "\\mathmit{Z}";
-	m[54506] = "\\mathmit{a}";
-	m[54507] = "\\mathmit{b}";
-	m[54508] = "\\mathmit{c}";
-	m[54509] = "\\mathmit{d}";
-	m[54510] = "\\mathmit{e}";
-	m[54511] = "\\mathmit{f}";
-	m[54512] = "\\mathmit{g}";
-	m[54513] = "\\mathmit{h}";
-	m[54514] = "\\mathmit{i}";
-	m[54515] = "\\mathmit{j}";
-	m[54516] = "\\mathmit{k}";
-	m[54517] = "\\mathmit{l}";
-	m[54518] = "\\mathmit{m}";
-	m[54519] = "\\mathmit{n}";
-	m[54520] = "\\mathmit{o}";
-	m[54521] = "\\mathmit{p}";
-	m[54522] = "\\mathmit{q}";
-	m[54523] = "\\mathmit{r}";
-	m[54524] = "\\mathmit{s}";
-	m[54525] = "\\mathmit{t}";
-	m[54526] = "\\mathmit{u}";
-	m[54527] = "\\mathmit{v}";
-	m[54528] = "\\mathmit{w}";
-	m[54529] = "\\mathmit{x}";
-	m[54530] = "\\mathmit{y}";
-	m[54531] = "\\mathmit{z}";
-	m[54532] = "\\mathfrak{A}";
-	m[54533] = "\\mathfrak{B}";
-	m[54535] = "\\mathfrak{D}";
-	m[54536] = "\\mathfrak{E}";
-	m[54537] = "\\mathfrak{F}";
-	m[54538] = "\\mathfrak{G}";
-	m[54541] = "\\mathfrak{J}";
-	m[54542] = "\\mathfrak{K}";
-	m[54543] = "\\mathfrak{L}";
-	m[54544] = "\\mathfrak{M}";
-	m[54545] = "\\mathfrak{N}";
-	m[54546] = "\\mathfrak{O}";
-	m[54547] = "\\mathfrak{P}";
-	m[54548] = "\\mathfrak{Q}";
-	m[54550] = "\\mathfrak{S}";
-	m[54551] = "\\mathfrak{T}";
-	m[54552] = "\\mathfrak{U}";
-	m[54553] = "\\mathfrak{V}";
-	m[54554] = "\\mathfrak{W}";
-	m[54555] = "\\mathfrak{X}";
-	m[54556] = "\\mathfrak{Y}";
-	m[54558] = "\\mathfrak{a}";
-	m[54559] = "\\mathfrak{b}";
-	m[54560] = "\\mathfrak{c}";
-	m[54561] = "\\mathfrak{d}";
-	m[54562] = "\\mathfrak{e}";
-	m[54563] = "\\mathfrak{f}";
-	m[54564] = "\\mathfrak{g}";
-	m[54565] = "\\mathfrak{h}";
-	m[54566] = "\\mathfrak{i}";
-	m[54567] = "\\mathfrak{j}";
-	m[54568] = "\\mathfrak{k}";
-	m[54569] = "\\mathfrak{l}";
-	m[54570] = "\\mathfrak{m}";
-	m[54571] = "\\mathfrak{n}";
-	m[54572] = "\\mathfrak{o}";
-	m[54573] = "\\mathfrak{p}";
-	m[54574] = "\\mathfrak{q}";
-	m[54575] = "\\mathfrak{r}";
-	m[54576] = "\\mathfrak{s}";
-	m[54577] = "\\mathfrak{t}";
-	m[54578] = "\\mathfrak{u}";
-	m[54579] = "\\mathfrak{v}";
-	m[54580] = "\\mathfrak{w}";
-	m[54581] = "\\mathfrak{x}";
-	m[54582] = "\\mathfrak{y}";
-	m[54583] = "\\mathfrak{z}";
-	m[54584] = "\\mathbb{A}";
-	m[54585] = "\\mathbb{B}";
-	m[54587] = "\\mathbb{D}";
-	m[54588] = "\\mathbb{E}";
-	m[54589] = "\\mathbb{F}";
-	m[54590] = "\\mathbb{G}";
-	m[54592] = "\\mathbb{I}";
-	m[54593] = "\\mathbb{J}";
-	m[54594] = "\\mathbb{K}";
-	m[54595] = "\\mathbb{L}";
-	m[54596] = "\\mathbb{M}";
-	m[54598] = "\\mathbb{O}";
-	m[54602] = "\\mathbb{S}";
-	m[54603] = "\\mathbb{T}";
-	m[54604] = "\\mathbb{U}";
-	m[54605] = "\\mathbb{V}";
-	m[54606] = "\\mathbb{W}";
-	m[54607] = "\\mathbb{X}";
-	m[54608] = "\\mathbb{Y}";
-	m[54610] = "\\mathbb{a}";
-	m[54611] = "\\mathbb{b}";
-	m[54612] = "\\mathbb{c}";
-	m[54613] = "\\mathbb{d}";
-	m[54614] = "\\mathbb{e}";
-	m[54615] = "\\mathbb{f}";
-	m[54616] = "\\mathbb{g}";
-	m[54617] = "\\mathbb{h}";
-	m[54618] = "\\mathbb{i}";
-	m[54619] = "\\mathbb{j}";
-	m[54620] = "\\mathbb{k}";
-	m[54621] = "\\mathbb{l}";
-	m[54622] = "\\mathbb{m}";
-	m[54623] = "\\mathbb{n}";
-	m[54624] = "\\mathbb{o}";
-	m[54625] = "\\mathbb{p}";
-	m[54626] = "\\mathbb{q}";
-	m[54627] = "\\mathbb{r}";
-	m[54628] = "\\mathbb{s}";
-	m[54629] = "\\mathbb{t}";
-	m[54630] = "\\mathbb{u}";
-	m[54631] = "\\mathbb{v}";
-	m[54632] = "\\mathbb{w}";
-	m[54633] = "\\mathbb{x}";
-	m[54634] = "\\mathbb{y}";
-	m[54635] = "\\mathbb{z}";
-	m[54636] = "\\mathslbb{A}";
-	m[54637] = "\\mathslbb{B}";
-	m[54638] = "\\mathslbb{C}";
-	m[54639] = "\\mathslbb{D}";
-	m[54640] = "\\mathslbb{E}";
-	m[54641] = "\\mathslbb{F}";
-	m[54642] = "\\mathslbb{G}";
-	m[54643] = "\\mathslbb{H}";
-	m[54644] = "\\mathslbb{I}";
-	m[54645] = "\\mathslbb{J}";
-	m[54646] = "\\mathslbb{K}";
-	m[54647] = "\\mathslbb{L}";
-	m[54648] = "\\mathslbb{M}";
-	m[54649] = "\\mathslbb{N}";
-	m[54650] = "\\mathslbb{O}";
-	m[54651] = "\\mathslbb{P}";
-	m[54652] = "\\mathslbb{Q}";
-	m[54653] = "\\mathslbb{R}";
-	m[54654] = "\\mathslbb{S}";
-	m[54655] = "\\mathslbb{T}";
-	m[54656] = "\\mathslbb{U}";
-	m[54657] = "\\mathslbb{V}";
-	m[54658] = "\\mathslbb{W}";
-	m[54659] = "\\mathslbb{X}";
-	m[54660] = "\\mathslbb{Y}";
-	m[54661] = "\\mathslbb{Z}";
-	m[54662] = "\\mathslbb{a}";
-	m[54663] = "\\mathslbb{b}";
-	m[54664] = "\\mathslbb{c}";
-	m[54665] = "\\mathslbb{d}";
-	m[54666] = "\\mathslbb{e}";
-	m[54667] = "\\mathslbb{f}";
-	m[54668] = "\\mathslbb{g}";
-	m[54669] = "\\mathslbb{h}";
-	m[54670] = "\\mathslbb{i}";
-	m[54671] = "\\mathslbb{j}";
-	m[54672] = "\\mathslbb{k}";
-	m[54673] = "\\mathslbb{l}";
-	m[54674] = "\\mathslbb{m}";
-	m[54675] = "\\mathslbb{n}";
-	m[54676] = "\\mathslbb{o}";
-	m[54677] = "\\mathslbb{p}";
-	m[54678] = "\\mathslbb{q}";
-	m[54679] = "\\mathslbb{r}";
-	m[54680] = "\\mathslbb{s}";
-	m[54681] = "\\mathslbb{t}";
-	m[54682] = "\\mathslbb{u}";
-	m[54683] = "\\mathslbb{v}";
-	m[54684] = "\\mathslbb{w}";
-	m[54685] = "\\mathslbb{x}";
-	m[54686] = "\\mathslbb{y}";
-	m[54687] = "\\mathslbb{z}";
-	m[54688] = "\\mathsf{A}";
-	m[54689] = "\\mathsf{B}";
-	m[54690] = "\\mathsf{C}";
-	m[54691] = "\\mathsf{D}";
-	m[54692] = "\\mathsf{E}";
-	m[54693] = "\\mathsf{F}";
-	m[54694] = "\\mathsf{G}";
-	m[54695] = "\\mathsf{H}";
-	m[54696] = "\\mathsf{I}";
-	m[54697] = "\\mathsf{J}";
-	m[54698] = "\\mathsf{K}";
-	m[54699] = "\\mathsf{L}";
-	m[54700] = "\\mathsf{M}";
-	m[54701] = "\\mathsf{N}";
-	m[54702] = "\\mathsf{O}";
-	m[54703] = "\\mathsf{P}";
-	m[54704] = "\\mathsf{Q}";
-	m[54705] = "\\mathsf{R}";
-	m[54706] = "\\mathsf{S}";
-	m[54707] = "\\mathsf{T}";
-	m[54708] = "\\mathsf{U}";
-	m[54709] = "\\mathsf{V}";
-	m[54710] = "\\mathsf{W}";
-	m[54711] = "\\mathsf{X}";
-	m[54712] = "\\mathsf{Y}";
-	m[54713] = "\\mathsf{Z}";
-	m[54714] = "\\mathsf{a}";
-	m[54715] = "\\mathsf{b}";
-	m[54716] = "\\mathsf{c}";
-	m[54717] = "\\mathsf{d}";
-	m[54718] = "\\mathsf{e}";
-	m[54719] = "\\mathsf{f}";
-	m[54720] = "\\mathsf{g}";
-	m[54721] = "\\mathsf{h}";
-	m[54722] = "\\mathsf{i}";
-	m[54723] = "\\mathsf{j}";
-	m[54724] = "\\mathsf{k}";
-	m[54725] = "\\mathsf{l}";
-	m[54726] = "\\mathsf{m}";
-	m[54727] = "\\mathsf{n}";
-	m[54728] = "\\mathsf{o}";
-	m[54729] = "\\mathsf{p}";
-	m[54730] = "\\mathsf{q}";
-	m[54731] = "\\mathsf{r}";
-	m[54732] = "\\mathsf{s}";
-	m[54733] = "\\mathsf{t}";
-	m[54734] = "\\mathsf{u}";
-	m[54735] = "\\mathsf{v}";
-	m[54736] = "\\mathsf{w}";
-	m[54737] = "\\mathsf{x}";
-	m[54738] = "\\mathsf{y}";
-	m[54739] = "\\mathsf{z}";
-	m[54740] = "\\mathsfbf{A}";
-	m[54741] = "\\mathsfbf{B}";
-	m[54742] = "\\mathsfbf{C}";
-	m[54743] = "\\mathsfbf{D}";
-	m[54744] = "\\mathsfbf{E}";
-	m[54745] = "\\mathsfbf{F}";
-	m[54746] = "\\mathsfbf{G}";
-	m[54747] = "\\mathsfbf{H}";
-	m[54748] = "\\mathsfbf{I}";
-	m[54749] = "\\mathsfbf{J}";
-	m[54750] = "\\mathsfbf{K}";
-	m[54751] = "\\mathsfbf{L}";
-	m[54752] = "\\mathsfbf{M}";
-	m[54753] = "\\mathsfbf{N}";
-	m[54754] = "\\mathsfbf{O}";
-	m[54755] = "\\mathsfbf{P}";
-	m[54756] = "\\mathsfbf{Q}";
-	m[54757] = "\\mathsfbf{R}";
-	m[54758] = "\\mathsfbf{S}";
-	m[54759] = "\\mathsfbf{T}";
-	m[54760] = "\\mathsfbf{U}";
-	m[54761] = "\\mathsfbf{V}";
-	m[54762] = "\\mathsfbf{W}";
-	m[54763] = "\\mathsfbf{X}";
-	m[54764] = "\\mathsfbf{Y}";
-	m[54765] = "\\mathsfbf{Z}";
-	m[54766] = "\\mathsfbf{a}";
-	m[54767] = "\\mathsfbf{b}";
-	m[54768] = "\\mathsfbf{c}";
-	m[54769] = "\\mathsfbf{d}";
-	m[54770] = "\\mathsfbf{e}";
-	m[54771] = "\\mathsfbf{f}";
-	m[54772] = "\\mathsfbf{g}";
-	m[54773] = "\\mathsfbf{h}";
-	m[54774] = "\\mathsfbf{i}";
-	m[54775] = "\\mathsfbf{j}";
-	m[54776] = "\\mathsfbf{k}";
-	m[54777] = "\\mathsfbf{l}";
-	m[54778] = "\\mathsfbf{m}";
-	m[54779] = "\\mathsfbf{n}";
-	m[54780] = "\\mathsfbf{o}";
-	m[54781] = "\\mathsfbf{p}";
-	m[54782] = "\\mathsfbf{q}";
-	m[54783] = "\\mathsfbf{r}";
-	m[54784] = "\\mathsfbf{s}";
-	m[54785] = "\\mathsfbf{t}";
-	m[54786] = "\\mathsfbf{u}";
-	m[54787] = "\\mathsfbf{v}";
-	m[54788] = "\\mathsfbf{w}";
-	m[54789] = "\\mathsfbf{x}";
-	m[54790] = "\\mathsfbf{y}";
-	m[54791] = "\\mathsfbf{z}";
-	m[54792] = "\\mathsfsl{A}";
-	m[54793] = "\\mathsfsl{B}";
-	m[54794] = "\\mathsfsl{C}";
-	m[54795] = "\\mathsfsl{D}";
-	m[54796] = "\\mathsfsl{E}";
-	m[54797] = "\\mathsfsl{F}";
-	m[54798] = "\\mathsfsl{G}";
-	m[54799] = "\\mathsfsl{H}";
-	m[54800] = "\\mathsfsl{I}";
-	m[54801] = "\\mathsfsl{J}";
-	m[54802] = "\\mathsfsl{K}";
-	m[54803] = "\\mathsfsl{L}";
-	m[54804] = "\\mathsfsl{M}";
-	m[54805] = "\\mathsfsl{N}";
-	m[54806] = "\\mathsfsl{O}";
-	m[54807] = "\\mathsfsl{P}";
-	m[54808] = "\\mathsfsl{Q}";
-	m[54809] = "\\mathsfsl{R}";
-	m[54810] = "\\mathsfsl{S}";
-	m[54811] = "\\mathsfsl{T}";
-	m[54812] = "\\mathsfsl{U}";
-	m[54813] = "\\mathsfsl{V}";
-	m[54814] = "\\mathsfsl{W}";
-	m[54815] = "\\mathsfsl{X}";
-	m[54816] = "\\mathsfsl{Y}";
-	m[54817] = "\\mathsfsl{Z}";
-	m[54818] = "\\mathsfsl{a}";
-	m[54819] = "\\mathsfsl{b}";
-	m[54820] = "\\mathsfsl{c}";
-	m[54821] = "\\mathsfsl{d}";
-	m[54822] = "\\mathsfsl{e}";
-	m[54823] = "\\mathsfsl{f}";
-	m[54824] = "\\mathsfsl{g}";
-	m[54825] = "\\mathsfsl{h}";
-	m[54826] = "\\mathsfsl{i}";
-	m[54827] = "\\mathsfsl{j}";
-	m[54828] = "\\mathsfsl{k}";
-	m[54829] = "\\mathsfsl{l}";
-	m[54830] = "\\mathsfsl{m}";
-	m[54831] = "\\mathsfsl{n}";
-	m[54832] = "\\mathsfsl{o}";
-	m[54833] = "\\mathsfsl{p}";
-	m[54834] = "\\mathsfsl{q}";
-	m[54835] = "\\mathsfsl{r}";
-	m[54836] = "\\mathsfsl{s}";
-	m[54837] = "\\mathsfsl{t}";
-	m[54838] = "\\mathsfsl{u}";
-	m[54839] = "\\mathsfsl{v}";
-	m[54840] = "\\mathsfsl{w}";
-	m[54841] = "\\mathsfsl{x}";
-	m[54842] = "\\mathsfsl{y}";
-	m[54843] = "\\mathsfsl{z}";
-	m[54844] = "\\mathsfbfsl{A}";
-	m[54845] = "\\mathsfbfsl{B}";
-	m[54846] = "\\mathsfbfsl{C}";
-	m[54847] = "\\mathsfbfsl{D}";
-	m[54848] = "\\mathsfbfsl{E}";
-	m[54849] = "\\mathsfbfsl{F}";
-	m[54850] = "\\mathsfbfsl{G}";
-	m[54851] = "\\mathsfbfsl{H}";
-	m[54852] = "\\mathsfbfsl{I}";
-	m[54853] = "\\mathsfbfsl{J}";
-	m[54854] = "\\mathsfbfsl{K}";
-	m[54855] = "\\mathsfbfsl{L}";
-	m[54856] = "\\mathsfbfsl{M}";
-	m[54857] = "\\mathsfbfsl{N}";
-	m[54858] = "\\mathsfbfsl{O}";
-	m[54859] = "\\mathsfbfsl{P}";
-	m[54860] = "\\mathsfbfsl{Q}";
-	m[54861] = "\\mathsfbfsl{R}";
-	m[54862] = "\\mathsfbfsl{S}";
-	m[54863] = "\\mathsfbfsl{T}";
-	m[54864] = "\\mathsfbfsl{U}";
-	m[54865] = "\\mathsfbfsl{V}";
-	m[54866] = "\\mathsfbfsl{W}";
-	m[54867] = "\\mathsfbfsl{X}";
-	m[54868] = "\\mathsfbfsl{Y}";
-	m[54869] = "\\mathsfbfsl{Z}";
-	m[54870] = "\\mathsfbfsl{a}";
-	m[54871] = "\\mathsfbfsl{b}";
-	m[54872] = "\\mathsfbfsl{c}";
-	m[54873] = "\\mathsfbfsl{d}";
-	m[54874] = "\\mathsfbfsl{e}";
-	m[54875] = "\\mathsfbfsl{f}";
-	m[54876] = "\\mathsfbfsl{g}";
-	m[54877] = "\\mathsfbfsl{h}";
-	m[54878] = "\\mathsfbfsl{i}";
-	m[54879] = "\\mathsfbfsl{j}";
-	m[54880] = "\\mathsfbfsl{k}";
-	m[54881] = "\\mathsfbfsl{l}";
-	m[54882] = "\\mathsfbfsl{m}";
-	m[54883] = "\\mathsfbfsl{n}";
-	m[54884] = "\\mathsfbfsl{o}";
-	m[54885] = "\\mathsfbfsl{p}";
-	m[54886] = "\\mathsfbfsl{q}";
-	m[54887] = "\\mathsfbfsl{r}";
-	m[54888] = "\\mathsfbfsl{s}";
-	m[54889] = "\\mathsfbfsl{t}";
-	m[54890] = "\\mathsfbfsl{u}";
-	m[54891] = "\\mathsfbfsl{v}";
-	m[54892] = "\\mathsfbfsl{w}";
-	m[54893] = "\\mathsfbfsl{x}";
-	m[54894] = "\\mathsfbfsl{y}";
-	m[54895] = "\\mathsfbfsl{z}";
-	m[54896] = "\\mathtt{A}";
-	m[54897] = "\\mathtt{B}";
-	m[54898] = "\\mathtt{C}";
-	m[54899] = "\\mathtt{D}";
-	m[54900] = "\\mathtt{E}";
-	m[54901] = "\\mathtt{F}";
-	m[54902] = "\\mathtt{G}";
-	m[54903] = "\\mathtt{H}";
-	m[54904] = "\\mathtt{I}";
-	m[54905] = "\\mathtt{J}";
-	m[54906] = "\\mathtt{K}";
-	m[54907] = "\\mathtt{L}";
-	m[54908] = "\\mathtt{M}";
-	m[54909] = "\\mathtt{N}";
-	m[54910] = "\\mathtt{O}";
-	m[54911] = "\\mathtt{P}";
-	m[54912] = "\\mathtt{Q}";
-	m[54913] = "\\mathtt{R}";
-	m[54914] = "\\mathtt{S}";
-	m[54915] = "\\mathtt{T}";
-	m[54916] = "\\mathtt{U}";
-	m[54917] = "\\mathtt{V}";
-	m[54918] = "\\mathtt{W}";
-	m[54919] = "\\mathtt{X}";
-	m[54920] = "\\mathtt{Y}";
-	m[54921] = "\\mathtt{Z}";
-	m[54922] = "\\mathtt{a}";
-	m[54923] = "\\mathtt{b}";
-	m[54924] = "\\mathtt{c}";
-	m[54925] = "\\mathtt{d}";
-	m[54926] = "\\mathtt{e}";
-	m[54927] = "\\mathtt{f}";
-	m[54928] = "\\mathtt{g}";
-	m[54929] = "\\mathtt{h}";
-	m[54930] = "\\mathtt{i}";
-	m[54931] = "\\mathtt{j}";
-	m[54932] = "\\mathtt{k}";
-	m[54933] = "\\mathtt{l}";
-	m[54934] = "\\mathtt{m}";
-	m[54935] = "\\mathtt{n}";
-	m[54936] = "\\mathtt{o}";
-	m[54937] = "\\mathtt{p}";
-	m[54938] = "\\mathtt{q}";
-	m[54939] = "\\mathtt{r}";
-	m[54940] = "\\mathtt{s}";
-	m[54941] = "\\mathtt{t}";
-	m[54942] = "\\mathtt{u}";
-	m[54943] = "\\mathtt{v}";
-	m[54944] = "\\mathtt{w}";
-	m[54945] = "\\mathtt{x}";
-	m[54946] = "\\mathtt{y}";
-	m[54947] = "\\mathtt{z}";
-	m[54952] = "\\mathbf{\\Alpha}";
-	m[54953] = "\\mathbf{\\Beta}";
-	m[54954] = "\\mathbf{\\Gamma}";
-	m[54955] = "\\mathbf{\\Delta}";
-	m[54956] = "\\mathbf{\\Epsilon}";
-	m[54957] = "\\mathbf{\\Zeta}";
-	m[54958] = "\\mathbf{\\Eta}";
-	m[54959] = "\\mathbf{\\Theta}";
-	m[54960] = "\\mathbf{\\Iota}";
-	m[54961] = "\\mathbf{\\Kappa}";
-	m[54962] = "\\mathbf{\\Lambda}";
-	m[54965] = "\\mathbf{\\Xi}";
-	m[54967] = "\\mathbf{\\Pi}";
-	m[54968] = "\\mathbf{\\Rho}";
-	m[54969] = "\\mathbf{\\vartheta}";
-	m[54970] = "\\mathbf{\\Sigma}";
-	m[54971] = "\\mathbf{\\Tau}";
-	m[54972] = "\\mathbf{\\Upsilon}";
-	m[54973] = "\\mathbf{\\Phi}";
-	m[54974] = "\\mathbf{\\Chi}";
-	m[54975] = "\\mathbf{\\Psi}";
-	m[54976] = "\\mathbf{\\Omega}";
-	m[54977] = "\\mathbf{\\nabla}";
-	m[54978] = "\\mathbf{\\Alpha}";
-	m[54979] = "\\mathbf{\\Beta}";
-	m[54980] = "\\mathbf{\\Gamma}";
-	m[54981] = "\\mathbf{\\Delta}";
-	m[54982] = "\\mathbf{\\Epsilon}";
-	m[54983] = "\\mathbf{\\Zeta}";
-	m[54984] = "\\mathbf{\\Eta}";
-	m[54985] = "\\mathbf{\\theta}";
-	m[54986] = "\\mathbf{\\Iota}";
-	m[54987] = "\\mathbf{\\Kappa}";
-	m[54988] = "\\mathbf{\\Lambda}";
-	m[54991] = "\\mathbf{\\Xi}";
-	m[54993] = "\\mathbf{\\Pi}";
-	m[54994] = "\\mathbf{\\Rho}";
-	m[54995] = "\\mathbf{\\varsigma}";
-	m[54996] = "\\mathbf{\\Sigma}";
-	m[54997] = "\\mathbf{\\Tau}";
-	m[54998] = "\\mathbf{\\Upsilon}";
-	m[54999] = "\\mathbf{\\Phi}";
-	m[55000] = "\\mathbf{\\Chi}";
-	m[55001] = "\\mathbf{\\Psi}";
-	m[55002] = "\\mathbf{\\Omega}";
-	m[55003] = "\\partial ";
-	m[55004] = "\\in";
-	m[55005] = "\\mathbf{\\vartheta}";
-	m[55006] = "\\mathbf{\\varkappa}";
-	m[55007] = "\\mathbf{\\phi}";
-	m[55008] = "\\mathbf{\\varrho}";
-	m[55009] = "\\mathbf{\\varpi}";
-	m[55010] = "\\mathsl{\\Alpha}";
-	m[55011] = "\\mathsl{\\Beta}";
-	m[55012] = "\\mathsl{\\Gamma}";
-	m[55013] = "\\mathsl{\\Delta}";
-	m[55014] = "\\mathsl{\\Epsilon}";
-	m[55015] = "\\mathsl{\\Zeta}";
-	m[55016] = "\\mathsl{\\Eta}";
-	m[55017] = "\\mathsl{\\Theta}";
-	m[55018] = "\\mathsl{\\Iota}";
-	m[55019] = "\\mathsl{\\Kappa}";
-	m[55020] = "\\mathsl{\\Lambda}";
-	m[55023] = "\\mathsl{\\Xi}";
-	m[55025] = "\\mathsl{\\Pi}";
-	m[55026] = "\\mathsl{\\Rho}";
-	m[55027] = "\\mathsl{\\vartheta}";
-	m[55028] = "\\mathsl{\\Sigma}";
-	m[55029] = "\\mathsl{\\Tau}";
-	m[55030] = "\\mathsl{\\Upsilon}";
-	m[55031] = "\\mathsl{\\Phi}";
-	m[55032] = "\\mathsl{\\Chi}";
-	m[55033] = "\\mathsl{\\Psi}";
-	m[55034] = "\\mathsl{\\Omega}";
-	m[55035] = "\\mathsl{\\nabla}";
-	m[55036] = "\\mathsl{\\Alpha}";
-	m[55037] = "\\mathsl{\\Beta}";
-	m[55038] = "\\mathsl{\\Gamma}";
-	m[55039] = "\\mathsl{\\Delta}";
-	m[55040] = "\\mathsl{\\Epsilon}";
-	m[55041] = "\\mathsl{\\Zeta}";
-	m[55042] = "\\mathsl{\\Eta}";
-	m[55043] = "\\mathsl{\\Theta}";
-	m[55044] = "\\mathsl{\\Iota}";
-	m[55045] = "\\mathsl{\\Kappa}";
-	m[55046] = "\\mathsl{\\Lambda}";
-	m[55049] = "\\mathsl{\\Xi}";
-	m[55051] = "\\mathsl{\\Pi}";
-	m[55052] = "\\mathsl{\\Rho}";
-	m[55053] = "\\mathsl{\\varsigma}";
-	m[55054] = "\\mathsl{\\Sigma}";
-	m[55055] = "\\mathsl{\\Tau}";
-	m[55056] = "\\mathsl{\\Upsilon}";
-	m[55057] = "\\mathsl{\\Phi}";
-	m[55058] = "\\mathsl{\\Chi}";
-	m[55059] = "\\mathsl{\\Psi}";
-	m[55060] = "\\mathsl{\\Omega}";
-	m[55061] = "\\partial ";
-	m[55062] = "\\in";
-	m[55063] = "\\mathsl{\\vartheta}";
-	m[55064] = "\\mathsl{\\varkappa}";
-	m[55065] = "\\mathsl{\\phi}";
-	m[55066] = "\\mathsl{\\varrho}";
-	m[55067] = "\\mathsl{\\varpi}";
-	m[55068] = "\\mathbit{\\Alpha}";
-	m[55069] = "\\mathbit{\\Beta}";
-	m[55070] = "\\mathbit{\\Gamma}";
-	m[55071] = "\\mathbit{\\Delta}";
-	m[55072] = "\\mathbit{\\Epsilon}";
-	m[55073] = "\\mathbit{\\Zeta}";
-	m[55074] = "\\mathbit{\\Eta}";
-	m[55075] = "\\mathbit{\\Theta}";
-	m[55076] = "\\mathbit{\\Iota}";
-	m[55077] = "\\mathbit{\\Kappa}";
-	m[55078] = "\\mathbit{\\Lambda}";
-	m[55081] = "\\mathbit{\\Xi}";
-	m[55083] = "\\mathbit{\\Pi}";
-	m[55084] = "\\mathbit{\\Rho}";
-	m[55085] = "\\mathbit{O}";
-	m[55086] = "\\mathbit{\\Sigma}";
-	m[55087] = "\\mathbit{\\Tau}";
-	m[55088] = "\\mathbit{\\Upsilon}";
-	m[55089] = "\\mathbit{\\Phi}";
-	m[55090] = "\\mathbit{\\Chi}";
-	m[55091] = "\\mathbit{\\Psi}";
-	m[55092] = "\\mathbit{\\Omega}";
-	m[55093] = "\\mathbit{\\nabla}";
-	m[55094] = "\\mathbit{\\Alpha}";
-	m[55095] = "\\mathbit{\\Beta}";
-	m[55096] = "\\mathbit{\\Gamma}";
-	m[55097] = "\\mathbit{\\Delta}";
-	m[55098] = "\\mathbit{\\Epsilon}";
-	m[55099] = "\\mathbit{\\Zeta}";
-	m[55100] = "\\mathbit{\\Eta}";
-	m[55101] = "\\mathbit{\\Theta}";
-	m[55102] = "\\mathbit{\\Iota}";
-	m[55103] = "\\mathbit{\\Kappa}";
-	m[55104] = "\\mathbit{\\Lambda}";
-	m[55107] = "\\mathbit{\\Xi}";
-	m[55109] = "\\mathbit{\\Pi}";
-	m[55110] = "\\mathbit{\\Rho}";
-	m[55111] = "\\mathbit{\\varsigma}";
-	m[55112] = "\\mathbit{\\Sigma}";
-	m[55113] = "\\mathbit{\\Tau}";
-	m[55114] = "\\mathbit{\\Upsilon}";
-	m[55115] = "\\mathbit{\\Phi}";
-	m[55116] = "\\mathbit{\\Chi}";
-	m[55117] = "\\mathbit{\\Psi}";
-	m[55118] = "\\mathbit{\\Omega}";
-	m[55119] = "\\partial ";
-	m[55120] = "\\in";
-	m[55121] = "\\mathbit{\\vartheta}";
-	m[55122] = "\\mathbit{\\varkappa}";
-	m[55123] = "\\mathbit{\\phi}";
-	m[55124] = "\\mathbit{\\varrho}";
-	m[55125] = "\\mathbit{\\varpi}";
-	m[55126] = "\\mathsfbf{\\Alpha}";
-	m[55127] = "\\mathsfbf{\\Beta}";
-	m[55128] = "\\mathsfbf{\\Gamma}";
-	m[55129] = "\\mathsfbf{\\Delta}";
-	m[55130] = "\\mathsfbf{\\Epsilon}";
-	m[55131] = "\\mathsfbf{\\Zeta}";
-	m[55132] = "\\mathsfbf{\\Eta}";
-	m[55133] = "\\mathsfbf{\\Theta}";
-	m[55134] = "\\mathsfbf{\\Iota}";
-	m[55135] = "\\mathsfbf{\\Kappa}";
-	m[55136] = "\\mathsfbf{\\Lambda}";
-	m[55139] = "\\mathsfbf{\\Xi}";
-	m[55141] = "\\mathsfbf{\\Pi}";
-	m[55142] = "\\mathsfbf{\\Rho}";
-	m[55143] = "\\mathsfbf{\\vartheta}";
-	m[55144] = "\\mathsfbf{\\Sigma}";
-	m[55145] = "\\mathsfbf{\\Tau}";
-	m[55146] = "\\mathsfbf{\\Upsilon}";
-	m[55147] = "\\mathsfbf{\\Phi}";
-	m[55148] = "\\mathsfbf{\\Chi}";
-	m[55149] = "\\mathsfbf{\\Psi}";
-	m[55150] = "\\mathsfbf{\\Omega}";
-	m[55151] = "\\mathsfbf{\\nabla}";
-	m[55152] = "\\mathsfbf{\\Alpha}";
-	m[55153] = "\\mathsfbf{\\Beta}";
-	m[55154] = "\\mathsfbf{\\Gamma}";
-	m[55155] = "\\mathsfbf{\\Delta}";
-	m[55156] = "\\mathsfbf{\\Epsilon}";
-	m[55157] = "\\mathsfbf{\\Zeta}";
-	m[55158] = "\\mathsfbf{\\Eta}";
-	m[55159] = "\\mathsfbf{\\Theta}";
-	m[55160] = "\\mathsfbf{\\Iota}";
-	m[55161] = "\\mathsfbf{\\Kappa}";
-	m[55162] = "\\mathsfbf{\\Lambda}";
-	m[55165] = "\\mathsfbf{\\Xi}";
-	m[55167] = "\\mathsfbf{\\Pi}";
-	m[55168] = "\\mathsfbf{\\Rho}";
-	m[55169] = "\\mathsfbf{\\varsigma}";
-	m[55170] = "\\mathsfbf{\\Sigma}";
-	m[55171] = "\\mathsfbf{\\Tau}";
-	m[55172] = "\\mathsfbf{\\Upsilon}";
-	m[55173] = "\\mathsfbf{\\Phi}";
-	m[55174] = "\\mathsfbf{\\Chi}";
-	m[55175] = "\\mathsfbf{\\Psi}";
-	m[55176] = "\\mathsfbf{\\Omega}";
-	m[55177] = "\\partial ";
-	m[55178] = "\\in";
-	m[55179] = "\\mathsfbf{\\vartheta}";
-	m[55180] = "\\mathsfbf{\\varkappa}";
-	m[55181] = "\\mathsfbf{\\phi}";
-	m[55182] = "\\mathsfbf{\\varrho}";
-	m[55183] = "\\mathsfbf{\\varpi}";
-	m[55184] = "\\mathsfbfsl{\\Alpha}";
-	m[55185] = "\\mathsfbfsl{\\Beta}";
-	m[55186] = "\\mathsfbfsl{\\Gamma}";
-	m[55187] = "\\mathsfbfsl{\\Delta}";
-	m[55188] = "\\mathsfbfsl{\\Epsilon}";
-	m[55189] = "\\mathsfbfsl{\\Zeta}";
-	m[55190] = "\\mathsfbfsl{\\Eta}";
-	m[55191] = "\\mathsfbfsl{\\vartheta}";
-	m[55192] = "\\mathsfbfsl{\\Iota}";
-	m[55193] = "\\mathsfbfsl{\\Kappa}";
-	m[55194] = "\\mathsfbfsl{\\Lambda}";
-	m[55197] = "\\mathsfbfsl{\\Xi}";
-	m[55199] = "\\mathsfbfsl{\\Pi}";
-	m[55200] = "\\mathsfbfsl{\\Rho}";
-	m[55201] = "\\mathsfbfsl{\\vartheta}";
-	m[55202] = "\\mathsfbfsl{\\Sigma}";
-	m[55203] = "\\mathsfbfsl{\\Tau}";
-	m[55204] = "\\mathsfbfsl{\\Upsilon}";
-	m[55205] = "\\mathsfbfsl{\\Phi}";
-	m[55206] = "\\mathsfbfsl{\\Chi}";
-	m[55207] = "\\mathsfbfsl{\\Psi}";
-	m[55208] = "\\mathsfbfsl{\\Omega}";
-	m[55209] = "\\mathsfbfsl{\\nabla}";
-	m[55210] = "\\mathsfbfsl{\\Alpha}";
-	m[55211] = "\\mathsfbfsl{\\Beta}";
-	m[55212] = "\\mathsfbfsl{\\Gamma}";
-	m[55213] = "\\mathsfbfsl{\\Delta}";
-	m[55214] = "\\mathsfbfsl{\\Epsilon}";
-	m[55215] = "\\mathsfbfsl{\\Zeta}";
-	m[55216] = "\\mathsfbfsl{\\Eta}";
-	m[55217] = "\\mathsfbfsl{\\vartheta}";
-	m[55218] = "\\mathsfbfsl{\\Iota}";
-	m[55219] = "\\mathsfbfsl{\\Kappa}";
-	m[55220] = "\\mathsfbfsl{\\Lambda}";
-	m[55223] = "\\mathsfbfsl{\\Xi}";
-	m[55225] = "\\mathsfbfsl{\\Pi}";
-	m[55226] = "\\mathsfbfsl{\\Rho}";
-	m[55227] = "\\mathsfbfsl{\\varsigma}";
-	m[55228] = "\\mathsfbfsl{\\Sigma}";
-	m[55229] = "\\mathsfbfsl{\\Tau}";
-	m[55230] = "\\mathsfbfsl{\\Upsilon}";
-	m[55231] = "\\mathsfbfsl{\\Phi}";
-	m[55232] = "\\mathsfbfsl{\\Chi}";
-	m[55233] = "\\mathsfbfsl{\\Psi}";
-	m[55234] = "\\mathsfbfsl{\\Omega}";
-	m[55235] = "\\partial ";
-	m[55236] = "\\in";
-	m[55237] = "\\mathsfbfsl{\\vartheta}";
-	m[55238] = "\\mathsfbfsl{\\varkappa}";
-	m[55239] = "\\mathsfbfsl{\\phi}";
-	m[55240] = "\\mathsfbfsl{\\varrho}";
-	m[55241] = "\\mathsfbfsl{\\varpi}";
-	m[55246] = "\\mathbf{0}";
-	m[55247] = "\\mathbf{1}";
-	m[55248] = "\\mathbf{2}";
-	m[55249] = "\\mathbf{3}";
-	m[55250] = "\\mathbf{4}";
-	m[55251] = "\\mathbf{5}";
-	m[55252] = "\\mathbf{6}";
-	m[55253] = "\\mathbf{7}";
-	m[55254] = "\\mathbf{8}";
-	m[55255] = "\\mathbf{9}";
-	m[55256] = "\\mathbb{0}";
-	m[55257] = "\\mathbb{1}";
-	m[55258] = "\\mathbb{2}";
-	m[55259] = "\\mathbb{3}";
-	m[55260] = "\\mathbb{4}";
-	m[55261] = "\\mathbb{5}";
-	m[55262] = "\\mathbb{6}";
-	m[55263] = "\\mathbb{7}";
-	m[55264] = "\\mathbb{8}";
-	m[55265] = "\\mathbb{9}";
-	m[55266] = "\\mathsf{0}";
-	m[55267] = "\\mathsf{1}";
-	m[55268] = "\\mathsf{2}";
-	m[55269] = "\\mathsf{3}";
-	m[55270] = "\\mathsf{4}";
-	m[55271] = "\\mathsf{5}";
-	m[55272] = "\\mathsf{6}";
-	m[55273] = "\\mathsf{7}";
-	m[55274] = "\\mathsf{8}";
-	m[55275] = "\\mathsf{9}";
-	m[55276] = "\\mathsfbf{0}";
-	m[55277] = "\\mathsfbf{1}";
-	m[55278] = "\\mathsfbf{2}";
-	m[55279] = "\\mathsfbf{3}";
-	m[55280] = "\\mathsfbf{4}";
-	m[55281] = "\\mathsfbf{5}";
-	m[55282] = "\\mathsfbf{6}";
-	m[55283] = "\\mathsfbf{7}";
-	m[55284] = "\\mathsfbf{8}";
-	m[55285] = "\\mathsfbf{9}";
-	m[55286] = "\\mathtt{0}";
-	m[55287] = "\\mathtt{1}";
-	m[55288] = "\\mathtt{2}";
-	m[55289] = "\\mathtt{3}";
-	m[55290] = "\\mathtt{4}";
-	m[55291] = "\\mathtt{5}";
-	m[55292] = "\\mathtt{6}";
-	m[55293] = "\\mathtt{7}";
-	m[55294] = "\\mathtt{8}";
-	m[55295] = "\\mathtt{9}";
-    return m;
+	size_t lo = 0, hi = compCount;
+	while (lo < hi)
+	{
+		size_t mid = (lo + hi) / 2;
+		const Composition& c = compTable[mid];
+		if (c.base < base || (c.base == base && c.mark < mark))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < compCount && compTable[lo].base == base && compTable[lo].mark == mark)
+		return compTable[lo].composed;
+	return 0;
+}
+
+string unicode_latex::compose(const string& s)
+{
+	const char* data = s.data();
+	size_t n = s.size();
+
+	string res;
+	res.reserve(n);
+
+	// the last character a following mark can be composed with (0 if blocked)
+	unsigned long last = 0;
+	size_t lastPos = 0;
+
+	size_t i = 0;
+	while (i < n)
+	{
+		size_t start = i;
+		unsigned long code;
+		if (!decode(data, n, i, code))
+		{
+			// invalid sequences are kept as is
+			res += data[i++];
+			last = 0;
+			continue;
+		}
+
+		bool mark = (code >= 0x300 && code <= 0x36F);
+		if (mark && last != 0)
+		{
+			// only into characters with a LaTeX form; otherwise the mark becomes an accent on the base
+			unsigned long composed = findComposition(last, code);
+			if (composed != 0 && find(composed) != nullptr)
+			{
+				res.resize(lastPos);
+				appendUTF8(res, composed);
+				last = composed;
+				continue;
+			}
+		}
+
+		lastPos = res.size();
+		res.append(data + start, i - start);
+		last = (mark ? 0 : code);
+	}
+
+	return res;
 }
+
+string unicode_latex::fold(unsigned long code)
+{
+	// letters without a canonical decomposition
+	static const Substitution special[] = {
+		{0x00C6, "ae"}, {0x00D0, "d"}, {0x00D8, "o"}, {0x00DE, "th"}, {0x00DF, "ss"},
+		{0x00E6, "ae"}, {0x00F0, "d"}, {0x00F8, "o"}, {0x00FE, "th"}, {0x0110, "d"},
+		{0x0111, "d"}, {0x0131, "i"}, {0x0141, "l"}, {0x0142, "l"}, {0x0152, "oe"},
+		{0x0153, "oe"}, {0x0237, "j"},
+	};
+	for (auto& sp : special)
+		if (sp.code == code) return sp.latex;
+
+	// stripping accents via the canonical compositions (possibly several levels)
+	static const vector<pair<unsigned long, unsigned long> > bases = []()
+	{
+		vector<pair<unsigned long, unsigned long> > res;
+		for (size_t i = 0; i < compCount; i++)
+			res.push_back(make_pair(compTable[i].composed, compTable[i].base));
+		sort(res.begin(), res.end());
+		return res;
+	}();
+
+	unsigned long base = code;
+	while (base > 0x7F)
+	{
+		auto it = lower_bound(bases.begin(), bases.end(), make_pair(base, 0UL));
+		if (it == bases.end() || it->first != base) break;
+		base = it->second;
+	}
+
+	if (base <= 0x7F)
+		return string(1, char(tolower((int)base)));
+	return "";
+}
+
+string unicode_latex::collationKey(const string& s, bool keepPunctuation)
+{
+	string t = transformToUnicode(s);
+	if (!isAscii(t))
+		t = compose(t);
+
+	const char* data = t.data();
+	size_t n = t.size();
+
+	string res;
+	res.reserve(n);
+	size_t i = 0;
+	while (i < n)
+	{
+		unsigned char ch = data[i];
+		if (ch <= 0x7F)
+		{
+			i++;
+			if (isalnum(ch))
+				res += char(tolower(ch));
+			else if (isspace(ch) || ch == '~')
+			{
+				if (!res.empty() && res.back() != ' ')
+					res += ' ';
+			}
+			else if (ch == '\\')
+			{
+				// remaining markup such as \emph or \textbf
+				while (i < n && isalpha((unsigned char)data[i]))
+					i++;
+			}
+			else if (keepPunctuation && ch != '{' && ch != '}')
+			{
+				res += char(ch);
+			}
+			continue;
+		}
+
+		size_t start = i;
+		unsigned long code;
+		if (!decode(data, n, i, code))
+		{
+			res += data[i++];
+			continue;
+		}
+
+		string folded = fold(code);
+		if (folded != "")
+			res += folded;
+		else if (code < 0x300 || code > 0x36F)
+			res.append(data + start, i - start);
+	}
+
+	if (!res.empty() && res.back() == ' ')
+		res.pop_back();
+	return res;
+}
+
+void unicode_latex::appendUTF8(string& res, unsigned long code)
+{
+	if (code <= 0x7F)
+	{
+		res += char(code);
+	}
+	else if (code <= 0x7FF)
+	{
+		res += char(0xC0 | (code >> 6));
+		res += char(0x80 | (code & 0x3F));
+	}
+	else if (code <= 0xFFFF)
+	{
+		res += char(0xE0 | (code >> 12));
+		res += char(0x80 | ((code >> 6) & 0x3F));
+		res += char(0x80 | (code & 0x3F));
+	}
+	else
+	{
+		res += char(0xF0 | (code >> 18));
+		res += char(0x80 | ((code >> 12) & 0x3F));
+		res += char(0x80 | ((code >> 6) & 0x3F));
+		res += char(0x80 | (code & 0x3F));
+	}
+}
+
+static bool isControlWord(const string& s)
+{
+	if (s.length() < 2 || s[0] != '\\') return false;
+	for (size_t i = 1; i < s.length(); i++)
+		if (!isalpha((unsigned char)s[i])) return false;
+	return true;
+}
+
+void unicode_latex::insertCommand(vector<TrieNode>& trie, const string& cmd, unsigned long code)
+{
+	int node = 0;
+	for (char c : cmd)
+	{
+		unsigned char ch = c;
+		int child = -1;
+		for (auto& e : trie[node].next)
+			if (e.first == ch) { child = e.second; break; }
+
+		if (child == -1)
+		{
+			child = (int)trie.size();
+			trie[node].next.push_back(make_pair(ch, child));
+			trie.push_back(TrieNode());
+		}
+		node = child;
+	}
+
+	// the first (smallest) code point wins for duplicated commands
+	if (trie[node].code == 0)
+	{
+		trie[node].code = code;
+		trie[node].word = isControlWord(cmd);
+	}
+}
+
+vector<unicode_latex::TrieNode> unicode_latex::buildTrie()
+{
+	vector<TrieNode> trie(1);
+	for (size_t i = 0; i < substCount; i++)
+	{
+		const Substitution& subst = substTable[i];
+		// keeping ASCII specials (\_, \%, ...) and skipping combining marks
+		if (subst.code <= 0x7F) continue;
+		if (subst.code >= 0x300 && subst.code <= 0x36F) continue;
+
+		string cmd = subst.latex;
+		if (cmd[0] != '\\') continue;
+		if (cmd.back() == ' ') cmd.pop_back();
+		insertCommand(trie, cmd, subst.code);
+
+		// accents: \'{e} is also written as \'e, \c{c} as \c c, and \'{\i} as \'{i} or \'\i
+		string accent = cmd.substr(0, 2);
+		string sep = (isalpha((unsigned char)cmd[1]) ? " " : "");
+		if (cmd.length() == 5 && cmd[2] == '{' && cmd[4] == '}')
+		{
+			insertCommand(trie, accent + sep + cmd[3], subst.code);
+		}
+		else if (cmd.length() == 6 && cmd[2] == '{' && cmd[3] == '\\' && cmd[5] == '}')
+		{
+			insertCommand(trie, accent + "{" + cmd[4] + "}", subst.code);
+			insertCommand(trie, accent + sep + cmd[4], subst.code);
+			insertCommand(trie, accent + cmd.substr(3, 2), subst.code);
+		}
+	}
+
+	return trie;
+}
+
+bool unicode_latex::matchCommand(const vector<TrieNode>& trie, const char* s, size_t n, size_t pos, size_t& end, unsigned long& code)
+{
+	// longest match among the commands starting at pos
+	code = 0;
+	int node = 0;
+	for (size_t i = pos; i < n; i++)
+	{
+		unsigned char ch = s[i];
+		int child = -1;
+		for (auto& e : trie[node].next)
+			if (e.first == ch) { child = e.second; break; }
+		if (child == -1) break;
+
+		node = child;
+		const TrieNode& tn = trie[node];
+		if (tn.code == 0) continue;
+
+		size_t j = i + 1;
+		if (tn.word)
+		{
+			// a control word ends at a non-letter; "{}" or a single space are consumed
+			if (j < n && isalpha((unsigned char)s[j])) continue;
+			if (j + 1 < n && s[j] == '{' && s[j + 1] == '}') j += 2;
+			else if (j < n && s[j] == ' ') j++;
+		}
+
+		code = tn.code;
+		end = j;
+	}
+
+	return code != 0;
+}
+
+string unicode_latex::transformToUnicode(const string& s)
+{
+	static const vector<TrieNode> trie = buildTrie();
+
+	const char* data = s.data();
+	size_t n = s.size();
+
+	const void* p = memchr(data, '\\', n);
+	if (p == nullptr) return s;
+
+	string res;
+	res.reserve(n);
+	size_t copied = 0;
+	// math mode is tracked by the unescaped dollar signs before the current command
+	bool hasMath = (memchr(data, '$', n) != nullptr);
+	bool math = false;
+	size_t scanned = 0;
+	while (p != nullptr)
+	{
+		size_t pos = (const char*)p - data;
+		size_t end;
+		unsigned long code;
+		size_t next = pos + 1;
+		for (; hasMath && scanned < pos; scanned++)
+			if (data[scanned] == '$' && (scanned == 0 || data[scanned - 1] != '\\'))
+				math = !math;
+
+		if (!math && matchCommand(trie, data, n, pos, end, code))
+		{
+			// dropping the braces around a single converted command: {\"o},
+			// unless they are the delimiters of the whole value
+			size_t from = pos, to = end;
+			if (pos > copied && data[pos - 1] == '{' && end < n && data[end] == '}' && !(pos == 1 && end + 1 == n))
+				from--, to++;
+
+			res.append(data + copied, from - copied);
+			appendUTF8(res, code);
+			copied = next = to;
+		}
+		else if (pos + 1 < n && data[pos + 1] == '\\')
+		{
+			next = pos + 2;
+		}
+
+		p = (next < n ? memchr(data + next, '\\', n - next) : nullptr);
+	}
+	res.append(data + copied, n - copied);
+
+	return res;
+}
+
+const char* unicode_latex::find(unsigned long code)
+{
+	if (code > 0xFFFF) return nullptr;
+
+	unsigned short slot = substSlots[substPages[code >> 8]][code & 0xFF];
+	if (slot == 0) return nullptr;
+	return substTable[slot - 1].latex;
+}
+
+// sorted by code point
+const unicode_latex::Substitution unicode_latex::substTable[] = {
+	{32, "\\space "},
+	{35, "\\#"},
+	{36, "\\textdollar "},
+	{37, "\\%"},
+	{38, "\\&amp;"},
+	{39, "\\textquotesingle "},
+	{42, "\\ast "},
+	{92, "\\textbackslash "},
+	{94, "\\^{}"},
+	{95, "\\_"},
+	{96, "\\textasciigrave "},
+	{123, "\\lbrace "},
+	{124, "\\vert "},
+	{125, "\\rbrace "},
+	{126, "\\textasciitilde "},
+	{161, "\\textexclamdown "},
+	{162, "\\textcent "},
+	{163, "\\textsterling "},
+	{164, "\\textcurrency "},
+	{165, "\\textyen "},
+	{166, "\\textbrokenbar "},
+	{167, "\\textsection "},
+	{168, "\\textasciidieresis "},
+	{169, "\\textcopyright "},
+	{170, "\\textordfeminine "},
+	{171, "\\guillemotleft "},
+	{172, "\\lnot "},
+	{173, "\\-"},
+	{174, "\\textregistered "},
+	{175, "\\textasciimacron "},
+	{176, "\\textdegree "},
+	{177, "\\pm "},
+	{178, "{^2}"},
+	{179, "{^3}"},
+	{180, "\\textasciiacute "},
+	{181, "\\mathrm{\\mu}"},
+	{182, "\\textparagraph "},
+	{183, "\\cdot "},
+	{184, "\\c{}"},
+	{185, "{^1}"},
+	{186, "\\textordmasculine "},
+	{187, "\\guillemotright "},
+	{188, "\\textonequarter "},
+	{189, "\\textonehalf "},
+	{190, "\\textthreequarters "},
+	{191, "\\textquestiondown "},
+	{192, "\\`{A}"},
+	{193, "\\'{A}"},
+	{194, "\\^{A}"},
+	{195, "\\~{A}"},
+	{196, "\\\"{A}"},
+	{197, "\\AA "},
+	{198, "\\AE "},
+	{199, "\\c{C}"},
+	{200, "\\`{E}"},
+	{201, "\\'{E}"},
+	{202, "\\^{E}"},
+	{203, "\\\"{E}"},
+	{204, "\\`{I}"},
+	{205, "\\'{I}"},
+	{206, "\\^{I}"},
+	{207, "\\\"{I}"},
+	{208, "\\DH "},
+	{209, "\\~{N}"},
+	{210, "\\`{O}"},
+	{211, "\\'{O}"},
+	{212, "\\^{O}"},
+	{213, "\\~{O}"},
+	{214, "\\\"{O}"},
+	{215, "\\texttimes "},
+	{216, "\\O "},
+	{217, "\\`{U}"},
+	{218, "\\'{U}"},
+	{219, "\\^{U}"},
+	{220, "\\\"{U}"},
+	{221, "\\'{Y}"},
+	{222, "\\TH "},
+	{223, "\\ss "},
+	{224, "\\`{a}"},
+	{225, "\\'{a}"},
+	{226, "\\^{a}"},
+	{227, "\\~{a}"},
+	{228, "\\\"{a}"},
+	{229, "\\aa "},
+	{230, "\\ae "},
+	{231, "\\c{c}"},
+	{232, "\\`{e}"},
+	{233, "\\'{e}"},
+	{234, "\\^{e}"},
+	{235, "\\\"{e}"},
+	{236, "\\`{\\i}"},
+	{237, "\\'{\\i}"},
+	{238, "\\^{\\i}"},
+	{239, "\\\"{\\i}"},
+	{240, "\\dh "},
+	{241, "\\~{n}"},
+	{242, "\\`{o}"},
+	{243, "\\'{o}"},
+	{244, "\\^{o}"},
+	{245, "\\~{o}"},
+	{246, "\\\"{o}"},
+	{247, "\\div "},
+	{248, "\\o "},
+	{249, "\\`{u}"},
+	{250, "\\'{u}"},
+	{251, "\\^{u}"},
+	{252, "\\\"{u}"},
+	{253, "\\'{y}"},
+	{254, "\\th "},
+	{255, "\\\"{y}"},
+	{256, "\\={A}"},
+	{257, "\\={a}"},
+	{258, "\\u{A}"},
+	{259, "\\u{a}"},
+	{260, "\\k{A}"},
+	{261, "\\k{a}"},
+	{262, "\\'{C}"},
+	{263, "\\'{c}"},
+	{264, "\\^{C}"},
+	{265, "\\^{c}"},
+	{266, "\\.{C}"},
+	{267, "\\.{c}"},
+	{268, "\\v{C}"},
+	{269, "\\v{c}"},
+	{270, "\\v{D}"},
+	{271, "\\v{d}"},
+	{272, "\\DJ "},
+	{273, "\\dj "},
+	{274, "\\={E}"},
+	{275, "\\={e}"},
+	{276, "\\u{E}"},
+	{277, "\\u{e}"},
+	{278, "\\.{E}"},
+	{279, "\\.{e}"},
+	{280, "\\k{E}"},
+	{281, "\\k{e}"},
+	{282, "\\v{E}"},
+	{283, "\\v{e}"},
+	{284, "\\^{G}"},
+	{285, "\\^{g}"},
+	{286, "\\u{G}"},
+	{287, "\\u{g}"},
+	{288, "\\.{G}"},
+	{289, "\\.{g}"},
+	{290, "\\c{G}"},
+	{291, "\\c{g}"},
+	{292, "\\^{H}"},
+	{293, "\\^{h}"},
+	{294, "{\\fontencoding{LELA}\\selectfont\\char40}"},
+	{295, "\\Elzxh "},
+	{296, "\\~{I}"},
+	{297, "\\~{\\i}"},
+	{298, "\\={I}"},
+	{299, "\\={\\i}"},
+	{300, "\\u{I}"},
+	{301, "\\u{\\i}"},
+	{302, "\\k{I}"},
+	{303, "\\k{i}"},
+	{304, "\\.{I}"},
+	{305, "\\i "},
+	{306, "IJ"},
+	{307, "ij"},
+	{308, "\\^{J}"},
+	{309, "\\^{\\j}"},
+	{310, "\\c{K}"},
+	{311, "\\c{k}"},
+	{312, "{\\fontencoding{LELA}\\selectfont\\char91}"},
+	{313, "\\'{L}"},
+	{314, "\\'{l}"},
+	{315, "\\c{L}"},
+	{316, "\\c{l}"},
+	{317, "\\v{L}"},
+	{318, "\\v{l}"},
+	{319, "{\\fontencoding{LELA}\\selectfont\\char201}"},
+	{320, "{\\fontencoding{LELA}\\selectfont\\char202}"},
+	{321, "\\L "},
+	{322, "\\l "},
+	{323, "\\'{N}"},
+	{324, "\\'{n}"},
+	{325, "\\c{N}"},
+	{326, "\\c{n}"},
+	{327, "\\v{N}"},
+	{328, "\\v{n}"},
+	{329, "'n"},
+	{330, "\\NG "},
+	{331, "\\ng "},
+	{332, "\\={O}"},
+	{333, "\\={o}"},
+	{334, "\\u{O}"},
+	{335, "\\u{o}"},
+	{336, "\\H{O}"},
+	{337, "\\H{o}"},
+	{338, "\\OE "},
+	{339, "\\oe "},
+	{340, "\\'{R}"},
+	{341, "\\'{r}"},
+	{342, "\\c{R}"},
+	{343, "\\c{r}"},
+	{344, "\\v{R}"},
+	{345, "\\v{r}"},
+	{346, "\\'{S}"},
+	{347, "\\'{s}"},
+	{348, "\\^{S}"},
+	{349, "\\^{s}"},
+	{350, "\\c{S}"},
+	{351, "\\c{s}"},
+	{352, "\\v{S}"},
+	{353, "\\v{s}"},
+	{354, "\\c{T}"},
+	{355, "\\c{t}"},
+	{356, "\\v{T}"},
+	{357, "\\v{t}"},
+	{358, "{\\fontencoding{LELA}\\selectfont\\char47}"},
+	{359, "{\\fontencoding{LELA}\\selectfont\\char63}"},
+	{360, "\\~{U}"},
+	{361, "\\~{u}"},
+	{362, "\\={U}"},
+	{363, "\\={u}"},
+	{364, "\\u{U}"},
+	{365, "\\u{u}"},
+	{366, "\\r{U}"},
+	{367, "\\r{u}"},
+	{368, "\\H{U}"},
+	{369, "\\H{u}"},
+	{370, "\\k{U}"},
+	{371, "\\k{u}"},
+	{372, "\\^{W}"},
+	{373, "\\^{w}"},
+	{374, "\\^{Y}"},
+	{375, "\\^{y}"},
+	{376, "\\\"{Y}"},
+	{377, "\\'{Z}"},
+	{378, "\\'{z}"},
+	{379, "\\.{Z}"},
+	{380, "\\.{z}"},
+	{381, "\\v{Z}"},
+	{382, "\\v{z}"},
+	{405, "\\texthvlig "},
+	{414, "\\textnrleg "},
+	{426, "\\eth "},
+	{442, "{\\fontencoding{LELA}\\selectfont\\char195}"},
+	{450, "\\textdoublepipe "},
+	{501, "\\'{g}"},
+	{592, "\\Elztrna "},
+	{594, "\\Elztrnsa "},
+	{596, "\\Elzopeno "},
+	{598, "\\Elzrtld "},
+	{600, "{\\fontencoding{LEIP}\\selectfont\\char61}"},
+	{601, "\\Elzschwa "},
+	{603, "\\varepsilon "},
+	{611, "\\Elzpgamma "},
+	{612, "\\Elzpbgam "},
+	{613, "\\Elztrnh "},
+	{620, "\\Elzbtdl "},
+	{621, "\\Elzrtll "},
+	{623, "\\Elztrnm "},
+	{624, "\\Elztrnmlr "},
+	{625, "\\Elzltlmr "},
+	{626, "\\Elzltln "},
+	{627, "\\Elzrtln "},
+	{631, "\\Elzclomeg "},
+	{632, "\\textphi "},
+	{633, "\\Elztrnr "},
+	{634, "\\Elztrnrl "},
+	{635, "\\Elzrttrnr "},
+	{636, "\\Elzrl "},
+	{637, "\\Elzrtlr "},
+	{638, "\\Elzfhr "},
+	{639, "{\\fontencoding{LEIP}\\selectfont\\char202}"},
+	{642, "\\Elzrtls "},
+	{643, "\\Elzesh "},
+	{647, "\\Elztrnt "},
+	{648, "\\Elzrtlt "},
+	{650, "\\Elzpupsil "},
+	{651, "\\Elzpscrv "},
+	{652, "\\Elzinvv "},
+	{653, "\\Elzinvw "},
+	{654, "\\Elztrny "},
+	{656, "\\Elzrtlz "},
+	{658, "\\Elzyogh "},
+	{660, "\\Elzglst "},
+	{661, "\\Elzreglst "},
+	{662, "\\Elzinglst "},
+	{670, "\\textturnk "},
+	{676, "\\Elzdyogh "},
+	{679, "\\Elztesh "},
+	{711, "\\textasciicaron "},
+	{712, "\\Elzverts "},
+	{716, "\\Elzverti "},
+	{720, "\\Elzlmrk "},
+	{721, "\\Elzhlmrk "},
+	{722, "\\Elzsbrhr "},
+	{723, "\\Elzsblhr "},
+	{724, "\\Elzrais "},
+	{725, "\\Elzlow "},
+	{728, "\\textasciibreve "},
+	{729, "\\textperiodcentered "},
+	{730, "\\r{}"},
+	{731, "\\k{}"},
+	{732, "\\texttildelow "},
+	{733, "\\H{}"},
+	{741, "\\tone{55}"},
+	{742, "\\tone{44}"},
+	{743, "\\tone{33}"},
+	{744, "\\tone{22}"},
+	{745, "\\tone{11}"},
+	{768, "\\`"},
+	{769, "\\'"},
+	{770, "\\^"},
+	{771, "\\~"},
+	{772, "\\="},
+	{774, "\\u"},
+	{775, "\\."},
+	{776, "\\\""},
+	{778, "\\r"},
+	{779, "\\H"},
+	{780, "\\v"},
+	{783, "\\cyrchar\\C"},
+	{785, "{\\fontencoding{LECO}\\selectfont\\char177}"},
+	{792, "{\\fontencoding{LECO}\\selectfont\\char184}"},
+	{793, "{\\fontencoding{LECO}\\selectfont\\char185}"},
+	{801, "\\Elzpalh "},
+	{802, "\\Elzrh "},
+	{807, "\\c"},
+	{808, "\\k"},
+	{810, "\\Elzsbbrg "},
+	{811, "{\\fontencoding{LECO}\\selectfont\\char203}"},
+	{815, "{\\fontencoding{LECO}\\selectfont\\char207}"},
+	{821, "\\Elzxl "},
+	{822, "\\Elzbar "},
+	{823, "{\\fontencoding{LECO}\\selectfont\\char215}"},
+	{824, "{\\fontencoding{LECO}\\selectfont\\char216}"},
+	{826, "{\\fontencoding{LECO}\\selectfont\\char218}"},
+	{827, "{\\fontencoding{LECO}\\selectfont\\char219}"},
+	{828, "{\\fontencoding{LECO}\\selectfont\\char220}"},
+	{829, "{\\fontencoding{LECO}\\selectfont\\char221}"},
+	{865, "{\\fontencoding{LECO}\\selectfont\\char225}"},
+	{902, "\\'{A}"},
+	{904, "\\'{E}"},
+	{905, "\\'{H}"},
+	{906, "\\'{}{I}"},
+	{908, "\\'{}O"},
+	{910, "\\mathrm{'Y}"},
+	{911, "\\mathrm{'\\Omega}"},
+	{912, "\\acute{\\ddot{\\iota}}"},
+	{913, "\\Alpha "},
+	{914, "\\Beta "},
+	{915, "\\Gamma "},
+	{916, "\\Delta "},
+	{917, "\\Epsilon "},
+	{918, "\\Zeta "},
+	{919, "\\Eta "},
+	{920, "\\Theta "},
+	{921, "\\Iota "},
+	{922, "\\Kappa "},
+	{923, "\\Lambda "},
+	{926, "\\Xi "},
+	{928, "\\Pi "},
+	{929, "\\Rho "},
+	{931, "\\Sigma "},
+	{932, "\\Tau "},
+	{933, "\\Upsilon "},
+	{934, "\\Phi "},
+	{935, "\\Chi "},
+	{936, "\\Psi "},
+	{937, "\\Omega "},
+	{938, "\\mathrm{\\ddot{I}}"},
+	{939, "\\mathrm{\\ddot{Y}}"},
+	{940, "\\'{$\\alpha$}"},
+	{941, "\\acute{\\epsilon}"},
+	{942, "\\acute{\\eta}"},
+	{943, "\\acute{\\iota}"},
+	{944, "\\acute{\\ddot{\\upsilon}}"},
+	{945, "\\alpha "},
+	{946, "\\beta "},
+	{947, "\\gamma "},
+	{948, "\\delta "},
+	{949, "\\epsilon "},
+	{950, "\\zeta "},
+	{951, "\\eta "},
+	{952, "\\texttheta "},
+	{953, "\\iota "},
+	{954, "\\kappa "},
+	{955, "\\lambda "},
+	{956, "\\mu "},
+	{957, "\\nu "},
+	{958, "\\xi "},
+	{960, "\\pi "},
+	{961, "\\rho "},
+	{962, "\\varsigma "},
+	{963, "\\sigma "},
+	{964, "\\tau "},
+	{965, "\\upsilon "},
+	{966, "\\varphi "},
+	{967, "\\chi "},
+	{968, "\\psi "},
+	{969, "\\omega "},
+	{970, "\\ddot{\\iota}"},
+	{971, "\\ddot{\\upsilon}"},
+	{972, "\\'{o}"},
+	{973, "\\acute{\\upsilon}"},
+	{974, "\\acute{\\omega}"},
+	{976, "\\Pisymbol{ppi022}{87}"},
+	{977, "\\textvartheta "},
+	{978, "\\Upsilon "},
+	{981, "\\phi "},
+	{982, "\\varpi "},
+	{986, "\\Stigma "},
+	{988, "\\Digamma "},
+	{989, "\\digamma "},
+	{990, "\\Koppa "},
+	{992, "\\Sampi "},
+	{1008, "\\varkappa "},
+	{1009, "\\varrho "},
+	{1012, "\\textTheta "},
+	{1014, "\\backepsilon "},
+	{1025, "\\cyrchar\\CYRYO "},
+	{1026, "\\cyrchar\\CYRDJE "},
+	{1027, "\\cyrchar{\\'\\CYRG}"},
+	{1028, "\\cyrchar\\CYRIE "},
+	{1029, "\\cyrchar\\CYRDZE "},
+	{1030, "\\cyrchar\\CYRII "},
+	{1031, "\\cyrchar\\CYRYI "},
+	{1032, "\\cyrchar\\CYRJE "},
+	{1033, "\\cyrchar\\CYRLJE "},
+	{1034, "\\cyrchar\\CYRNJE "},
+	{1035, "\\cyrchar\\CYRTSHE "},
+	{1036, "\\cyrchar{\\'\\CYRK}"},
+	{1038, "\\cyrchar\\CYRUSHRT "},
+	{1039, "\\cyrchar\\CYRDZHE "},
+	{1040, "\\cyrchar\\CYRA "},
+	{1041, "\\cyrchar\\CYRB "},
+	{1042, "\\cyrchar\\CYRV "},
+	{1043, "\\cyrchar\\CYRG "},
+	{1044, "\\cyrchar\\CYRD "},
+	{1045, "\\cyrchar\\CYRE "},
+	{1046, "\\cyrchar\\CYRZH "},
+	{1047, "\\cyrchar\\CYRZ "},
+	{1048, "\\cyrchar\\CYRI "},
+	{1049, "\\cyrchar\\CYRISHRT "},
+	{1050, "\\cyrchar\\CYRK "},
+	{1051, "\\cyrchar\\CYRL "},
+	{1052, "\\cyrchar\\CYRM "},
+	{1053, "\\cyrchar\\CYRN "},
+	{1054, "\\cyrchar\\CYRO "},
+	{1055, "\\cyrchar\\CYRP "},
+	{1056, "\\cyrchar\\CYRR "},
+	{1057, "\\cyrchar\\CYRS "},
+	{1058, "\\cyrchar\\CYRT "},
+	{1059, "\\cyrchar\\CYRU "},
+	{1060, "\\cyrchar\\CYRF "},
+	{1061, "\\cyrchar\\CYRH "},
+	{1062, "\\cyrchar\\CYRC "},
+	{1063, "\\cyrchar\\CYRCH "},
+	{1064, "\\cyrchar\\CYRSH "},
+	{1065, "\\cyrchar\\CYRSHCH "},
+	{1066, "\\cyrchar\\CYRHRDSN "},
+	{1067, "\\cyrchar\\CYRERY "},
+	{1068, "\\cyrchar\\CYRSFTSN "},
+	{1069, "\\cyrchar\\CYREREV "},
+	{1070, "\\cyrchar\\CYRYU "},
+	{1071, "\\cyrchar\\CYRYA "},
+	{1072, "\\cyrchar\\cyra "},
+	{1073, "\\cyrchar\\cyrb "},
+	{1074, "\\cyrchar\\cyrv "},
+	{1075, "\\cyrchar\\cyrg "},
+	{1076, "\\cyrchar\\cyrd "},
+	{1077, "\\cyrchar\\cyre "},
+	{1078, "\\cyrchar\\cyrzh "},
+	{1079, "\\cyrchar\\cyrz "},
+	{1080, "\\cyrchar\\cyri "},
+	{1081, "\\cyrchar\\cyrishrt "},
+	{1082, "\\cyrchar\\cyrk "},
+	{1083, "\\cyrchar\\cyrl "},
+	{1084, "\\cyrchar\\cyrm "},
+	{1085, "\\cyrchar\\cyrn "},
+	{1086, "\\cyrchar\\cyro "},
+	{1087, "\\cyrchar\\cyrp "},
+	{1088, "\\cyrchar\\cyrr "},
+	{1089, "\\cyrchar\\cyrs "},
+	{1090, "\\cyrchar\\cyrt "},
+	{1091, "\\cyrchar\\cyru "},
+	{1092, "\\cyrchar\\cyrf "},
+	{1093, "\\cyrchar\\cyrh "},
+	{1094, "\\cyrchar\\cyrc "},
+	{1095, "\\cyrchar\\cyrch "},
+	{1096, "\\cyrchar\\cyrsh "},
+	{1097, "\\cyrchar\\cyrshch "},
+	{1098, "\\cyrchar\\cyrhrdsn "},
+	{1099, "\\cyrchar\\cyrery "},
+	{1100, "\\cyrchar\\cyrsftsn "},
+	{1101, "\\cyrchar\\cyrerev "},
+	{1102, "\\cyrchar\\cyryu "},
+	{1103, "\\cyrchar\\cyrya "},
+	{1105, "\\cyrchar\\cyryo "},
+	{1106, "\\cyrchar\\cyrdje "},
+	{1107, "\\cyrchar{\\'\\cyrg}"},
+	{1108, "\\cyrchar\\cyrie "},
+	{1109, "\\cyrchar\\cyrdze "},
+	{1110, "\\cyrchar\\cyrii "},
+	{1111, "\\cyrchar\\cyryi "},
+	{1112, "\\cyrchar\\cyrje "},
+	{1113, "\\cyrchar\\cyrlje "},
+	{1114, "\\cyrchar\\cyrnje "},
+	{1115, "\\cyrchar\\cyrtshe "},
+	{1116, "\\cyrchar{\\'\\cyrk}"},
+	{1118, "\\cyrchar\\cyrushrt "},
+	{1119, "\\cyrchar\\cyrdzhe "},
+	{1120, "\\cyrchar\\CYROMEGA "},
+	{1121, "\\cyrchar\\cyromega "},
+	{1122, "\\cyrchar\\CYRYAT "},
+	{1124, "\\cyrchar\\CYRIOTE "},
+	{1125, "\\cyrchar\\cyriote "},
+	{1126, "\\cyrchar\\CYRLYUS "},
+	{1127, "\\cyrchar\\cyrlyus "},
+	{1128, "\\cyrchar\\CYRIOTLYUS "},
+	{1129, "\\cyrchar\\cyriotlyus "},
+	{1130, "\\cyrchar\\CYRBYUS "},
+	{1132, "\\cyrchar\\CYRIOTBYUS "},
+	{1133, "\\cyrchar\\cyriotbyus "},
+	{1134, "\\cyrchar\\CYRKSI "},
+	{1135, "\\cyrchar\\cyrksi "},
+	{1136, "\\cyrchar\\CYRPSI "},
+	{1137, "\\cyrchar\\cyrpsi "},
+	{1138, "\\cyrchar\\CYRFITA "},
+	{1140, "\\cyrchar\\CYRIZH "},
+	{1144, "\\cyrchar\\CYRUK "},
+	{1145, "\\cyrchar\\cyruk "},
+	{1146, "\\cyrchar\\CYROMEGARND "},
+	{1147, "\\cyrchar\\cyromegarnd "},
+	{1148, "\\cyrchar\\CYROMEGATITLO "},
+	{1149, "\\cyrchar\\cyromegatitlo "},
+	{1150, "\\cyrchar\\CYROT "},
+	{1151, "\\cyrchar\\cyrot "},
+	{1152, "\\cyrchar\\CYRKOPPA "},
+	{1153, "\\cyrchar\\cyrkoppa "},
+	{1154, "\\cyrchar\\cyrthousands "},
+	{1160, "\\cyrchar\\cyrhundredthousands "},
+	{1161, "\\cyrchar\\cyrmillions "},
+	{1164, "\\cyrchar\\CYRSEMISFTSN "},
+	{1165, "\\cyrchar\\cyrsemisftsn "},
+	{1166, "\\cyrchar\\CYRRTICK "},
+	{1167, "\\cyrchar\\cyrrtick "},
+	{1168, "\\cyrchar\\CYRGUP "},
+	{1169, "\\cyrchar\\cyrgup "},
+	{1170, "\\cyrchar\\CYRGHCRS "},
+	{1171, "\\cyrchar\\cyrghcrs "},
+	{1172, "\\cyrchar\\CYRGHK "},
+	{1173, "\\cyrchar\\cyrghk "},
+	{1174, "\\cyrchar\\CYRZHDSC "},
+	{1175, "\\cyrchar\\cyrzhdsc "},
+	{1176, "\\cyrchar\\CYRZDSC "},
+	{1177, "\\cyrchar\\cyrzdsc "},
+	{1178, "\\cyrchar\\CYRKDSC "},
+	{1179, "\\cyrchar\\cyrkdsc "},
+	{1180, "\\cyrchar\\CYRKVCRS "},
+	{1181, "\\cyrchar\\cyrkvcrs "},
+	{1182, "\\cyrchar\\CYRKHCRS "},
+	{1183, "\\cyrchar\\cyrkhcrs "},
+	{1184, "\\cyrchar\\CYRKBEAK "},
+	{1185, "\\cyrchar\\cyrkbeak "},
+	{1186, "\\cyrchar\\CYRNDSC "},
+	{1187, "\\cyrchar\\cyrndsc "},
+	{1188, "\\cyrchar\\CYRNG "},
+	{1189, "\\cyrchar\\cyrng "},
+	{1190, "\\cyrchar\\CYRPHK "},
+	{1191, "\\cyrchar\\cyrphk "},
+	{1192, "\\cyrchar\\CYRABHHA "},
+	{1193, "\\cyrchar\\cyrabhha "},
+	{1194, "\\cyrchar\\CYRSDSC "},
+	{1195, "\\cyrchar\\cyrsdsc "},
+	{1196, "\\cyrchar\\CYRTDSC "},
+	{1197, "\\cyrchar\\cyrtdsc "},
+	{1198, "\\cyrchar\\CYRY "},
+	{1199, "\\cyrchar\\cyry "},
+	{1200, "\\cyrchar\\CYRYHCRS "},
+	{1201, "\\cyrchar\\cyryhcrs "},
+	{1202, "\\cyrchar\\CYRHDSC "},
+	{1203, "\\cyrchar\\cyrhdsc "},
+	{1204, "\\cyrchar\\CYRTETSE "},
+	{1205, "\\cyrchar\\cyrtetse "},
+	{1206, "\\cyrchar\\CYRCHRDSC "},
+	{1207, "\\cyrchar\\cyrchrdsc "},
+	{1208, "\\cyrchar\\CYRCHVCRS "},
+	{1209, "\\cyrchar\\cyrchvcrs "},
+	{1210, "\\cyrchar\\CYRSHHA "},
+	{1211, "\\cyrchar\\cyrshha "},
+	{1212, "\\cyrchar\\CYRABHCH "},
+	{1213, "\\cyrchar\\cyrabhch "},
+	{1214, "\\cyrchar\\CYRABHCHDSC "},
+	{1215, "\\cyrchar\\cyrabhchdsc "},
+	{1216, "\\cyrchar\\CYRpalochka "},
+	{1219, "\\cyrchar\\CYRKHK "},
+	{1220, "\\cyrchar\\cyrkhk "},
+	{1223, "\\cyrchar\\CYRNHK "},
+	{1224, "\\cyrchar\\cyrnhk "},
+	{1227, "\\cyrchar\\CYRCHLDSC "},
+	{1228, "\\cyrchar\\cyrchldsc "},
+	{1236, "\\cyrchar\\CYRAE "},
+	{1237, "\\cyrchar\\cyrae "},
+	{1240, "\\cyrchar\\CYRSCHWA "},
+	{1241, "\\cyrchar\\cyrschwa "},
+	{1248, "\\cyrchar\\CYRABHDZE "},
+	{1249, "\\cyrchar\\cyrabhdze "},
+	{1256, "\\cyrchar\\CYROTLD "},
+	{1257, "\\cyrchar\\cyrotld "},
+	{8194, "\\hspace{0.6em}"},
+	{8195, "\\hspace{1em}"},
+	{8196, "\\hspace{0.33em}"},
+	{8197, "\\hspace{0.25em}"},
+	{8198, "\\hspace{0.166em}"},
+	{8199, "\\hphantom{0}"},
+	{8200, "\\hphantom{,}"},
+	{8201, "\\;"},
+	{8202, "\\mkern1mu "},
+	{8211, "\\textendash "},
+	{8212, "\\textemdash "},
+	{8213, "\\rule{1em}{1pt}"},
+	{8214, "\\Vert "},
+	{8219, "\\Elzreapos "},
+	{8220, "\\textquotedblleft "},
+	{8221, "\\textquotedblright "},
+	{8222, ","},
+	{8224, "\\textdagger "},
+	{8225, "\\textdaggerdbl "},
+	{8226, "\\textbullet "},
+	{8229, ".."},
+	{8230, "\\ldots "},
+	{8240, "\\textperthousand "},
+	{8241, "\\textpertenthousand "},
+	{8242, "{'}"},
+	{8243, "{''}"},
+	{8244, "{'''}"},
+	{8245, "\\backprime "},
+	{8249, "\\guilsinglleft "},
+	{8250, "\\guilsinglright "},
+	{8279, "''''"},
+	{8287, "\\mkern4mu "},
+	{8288, "\\nolinebreak "},
+	{8359, "\\ensuremath{\\Elzpes}"},
+	{8364, "\\mbox{\\texteuro} "},
+	{8411, "\\dddot "},
+	{8412, "\\ddddot "},
+	{8450, "\\mathbb{C}"},
+	{8458, "\\mathscr{g}"},
+	{8459, "\\mathscr{H}"},
+	{8460, "\\mathfrak{H}"},
+	{8461, "\\mathbb{H}"},
+	{8463, "\\hslash "},
+	{8464, "\\mathscr{I}"},
+	{8465, "\\mathfrak{I}"},
+	{8466, "\\mathscr{L}"},
+	{8467, "\\mathscr{l}"},
+	{8469, "\\mathbb{N}"},
+	{8470, "\\cyrchar\\textnumero "},
+	{8472, "\\wp "},
+	{8473, "\\mathbb{P}"},
+	{8474, "\\mathbb{Q}"},
+	{8475, "\\mathscr{R}"},
+	{8476, "\\mathfrak{R}"},
+	{8477, "\\mathbb{R}"},
+	{8478, "\\Elzxrat "},
+	{8482, "\\texttrademark "},
+	{8484, "\\mathbb{Z}"},
+	{8486, "\\Omega "},
+	{8487, "\\mho "},
+	{8488, "\\mathfrak{Z}"},
+	{8489, "\\ElsevierGlyph{2129}"},
+	{8491, "\\AA "},
+	{8492, "\\mathscr{B}"},
+	{8493, "\\mathfrak{C}"},
+	{8495, "\\mathscr{e}"},
+	{8496, "\\mathscr{E}"},
+	{8497, "\\mathscr{F}"},
+	{8499, "\\mathscr{M}"},
+	{8500, "\\mathscr{o}"},
+	{8501, "\\aleph "},
+	{8502, "\\beth "},
+	{8503, "\\gimel "},
+	{8504, "\\daleth "},
+	{8531, "\\textfrac{1}{3}"},
+	{8532, "\\textfrac{2}{3}"},
+	{8533, "\\textfrac{1}{5}"},
+	{8534, "\\textfrac{2}{5}"},
+	{8535, "\\textfrac{3}{5}"},
+	{8536, "\\textfrac{4}{5}"},
+	{8537, "\\textfrac{1}{6}"},
+	{8538, "\\textfrac{5}{6}"},
+	{8539, "\\textfrac{1}{8}"},
+	{8540, "\\textfrac{3}{8}"},
+	{8541, "\\textfrac{5}{8}"},
+	{8542, "\\textfrac{7}{8}"},
+	{8592, "\\leftarrow "},
+	{8593, "\\uparrow "},
+	{8594, "\\rightarrow "},
+	{8595, "\\downarrow "},
+	{8596, "\\leftrightarrow "},
+	{8597, "\\updownarrow "},
+	{8598, "\\nwarrow "},
+	{8599, "\\nearrow "},
+	{8600, "\\searrow "},
+	{8601, "\\swarrow "},
+	{8602, "\\nleftarrow "},
+	{8603, "\\nrightarrow "},
+	{8604, "\\arrowwaveright "},
+	{8605, "\\arrowwaveright "},
+	{8606, "\\twoheadleftarrow "},
+	{8608, "\\twoheadrightarrow "},
+	{8610, "\\leftarrowtail "},
+	{8611, "\\rightarrowtail "},
+	{8614, "\\mapsto "},
+	{8617, "\\hookleftarrow "},
+	{8618, "\\hookrightarrow "},
+	{8619, "\\looparrowleft "},
+	{8620, "\\looparrowright "},
+	{8621, "\\leftrightsquigarrow "},
+	{8622, "\\nleftrightarrow "},
+	{8624, "\\Lsh "},
+	{8625, "\\Rsh "},
+	{8627, "\\ElsevierGlyph{21B3}"},
+	{8630, "\\curvearrowleft "},
+	{8631, "\\curvearrowright "},
+	{8634, "\\circlearrowleft "},
+	{8635, "\\circlearrowright "},
+	{8636, "\\leftharpoonup "},
+	{8637, "\\leftharpoondown "},
+	{8638, "\\upharpoonright "},
+	{8639, "\\upharpoonleft "},
+	{8640, "\\rightharpoonup "},
+	{8641, "\\rightharpoondown "},
+	{8642, "\\downharpoonright "},
+	{8643, "\\downharpoonleft "},
+	{8644, "\\rightleftarrows "},
+	{8645, "\\dblarrowupdown "},
+	{8646, "\\leftrightarrows "},
+	{8647, "\\leftleftarrows "},
+	{8648, "\\upuparrows "},
+	{8649, "\\rightrightarrows "},
+	{8650, "\\downdownarrows "},
+	{8651, "\\leftrightharpoons "},
+	{8652, "\\rightleftharpoons "},
+	{8653, "\\nLeftarrow "},
+	{8654, "\\nLeftrightarrow "},
+	{8655, "\\nRightarrow "},
+	{8656, "\\Leftarrow "},
+	{8657, "\\Uparrow "},
+	{8658, "\\Rightarrow "},
+	{8659, "\\Downarrow "},
+	{8660, "\\Leftrightarrow "},
+	{8661, "\\Updownarrow "},
+	{8666, "\\Lleftarrow "},
+	{8667, "\\Rrightarrow "},
+	{8669, "\\rightsquigarrow "},
+	{8693, "\\DownArrowUpArrow "},
+	{8704, "\\forall "},
+	{8705, "\\complement "},
+	{8706, "\\partial "},
+	{8707, "\\exists "},
+	{8708, "\\nexists "},
+	{8709, "\\varnothing "},
+	{8711, "\\nabla "},
+	{8712, "\\in "},
+	{8713, "\\not\\in "},
+	{8715, "\\ni "},
+	{8716, "\\not\\ni "},
+	{8719, "\\prod "},
+	{8720, "\\coprod "},
+	{8721, "\\sum "},
+	{8723, "\\mp "},
+	{8724, "\\dotplus "},
+	{8726, "\\setminus "},
+	{8727, "{_\\ast}"},
+	{8728, "\\circ "},
+	{8729, "\\bullet "},
+	{8730, "\\surd "},
+	{8733, "\\propto "},
+	{8734, "\\infty "},
+	{8735, "\\rightangle "},
+	{8736, "\\angle "},
+	{8737, "\\measuredangle "},
+	{8738, "\\sphericalangle "},
+	{8739, "\\mid "},
+	{8740, "\\nmid "},
+	{8741, "\\parallel "},
+	{8742, "\\nparallel "},
+	{8743, "\\wedge "},
+	{8744, "\\vee "},
+	{8745, "\\cap "},
+	{8746, "\\cup "},
+	{8747, "\\int "},
+	{8748, "\\int\\!\\int "},
+	{8749, "\\int\\!\\int\\!\\int "},
+	{8750, "\\oint "},
+	{8751, "\\surfintegral "},
+	{8752, "\\volintegral "},
+	{8753, "\\clwintegral "},
+	{8754, "\\ElsevierGlyph{2232}"},
+	{8755, "\\ElsevierGlyph{2233}"},
+	{8756, "\\therefore "},
+	{8757, "\\because "},
+	{8759, "\\Colon "},
+	{8760, "\\ElsevierGlyph{2238}"},
+	{8762, "\\mathbin{{:}\\!\\!{-}\\!\\!{:}}"},
+	{8763, "\\homothetic "},
+	{8764, "\\sim "},
+	{8765, "\\backsim "},
+	{8766, "\\lazysinv "},
+	{8768, "\\wr "},
+	{8769, "\\not\\sim "},
+	{8770, "\\NotEqualTilde "},
+	{8771, "\\simeq "},
+	{8772, "\\not\\simeq "},
+	{8773, "\\cong "},
+	{8774, "\\approxnotequal "},
+	{8775, "\\not\\cong "},
+	{8776, "\\approx "},
+	{8777, "\\not\\approx "},
+	{8778, "\\approxeq "},
+	{8779, "\\not\\apid "},
+	{8780, "\\allequal "},
+	{8781, "\\asymp "},
+	{8782, "\\NotHumpDownHump "},
+	{8783, "\\NotHumpEqual "},
+	{8784, "\\not\\doteq"},
+	{8785, "\\doteqdot "},
+	{8786, "\\fallingdotseq "},
+	{8787, "\\risingdotseq "},
+	{8788, ":="},
+	{8789, "=:"},
+	{8790, "\\eqcirc "},
+	{8791, "\\circeq "},
+	{8793, "\\estimates "},
+	{8794, "\\ElsevierGlyph{225A}"},
+	{8795, "\\starequal "},
+	{8796, "\\triangleq "},
+	{8799, "\\ElsevierGlyph{225F}"},
+	{8800, "\\not ="},
+	{8801, "\\equiv "},
+	{8802, "\\not\\equiv "},
+	{8804, "\\leq "},
+	{8805, "\\geq "},
+	{8806, "\\leqq "},
+	{8807, "\\geqq "},
+	{8808, "\\lvertneqq "},
+	{8809, "\\gvertneqq "},
+	{8810, "\\NotLessLess "},
+	{8811, "\\NotGreaterGreater "},
+	{8812, "\\between "},
+	{8813, "\\not\\kern-0.3em\\times "},
+	{8814, "\\not&lt;"},
+	{8815, "\\not&gt;"},
+	{8816, "\\not\\leq "},
+	{8817, "\\not\\geq "},
+	{8818, "\\lessequivlnt "},
+	{8819, "\\greaterequivlnt "},
+	{8820, "\\ElsevierGlyph{2274}"},
+	{8821, "\\ElsevierGlyph{2275}"},
+	{8822, "\\lessgtr "},
+	{8823, "\\gtrless "},
+	{8824, "\\notlessgreater "},
+	{8825, "\\notgreaterless "},
+	{8826, "\\prec "},
+	{8827, "\\succ "},
+	{8828, "\\preccurlyeq "},
+	{8829, "\\succcurlyeq "},
+	{8830, "\\NotPrecedesTilde "},
+	{8831, "\\NotSucceedsTilde "},
+	{8832, "\\not\\prec "},
+	{8833, "\\not\\succ "},
+	{8834, "\\subset "},
+	{8835, "\\supset "},
+	{8836, "\\not\\subset "},
+	{8837, "\\not\\supset "},
+	{8838, "\\subseteq "},
+	{8839, "\\supseteq "},
+	{8840, "\\not\\subseteq "},
+	{8841, "\\not\\supseteq "},
+	{8842, "\\varsubsetneqq "},
+	{8843, "\\varsupsetneq "},
+	{8846, "\\uplus "},
+	{8847, "\\NotSquareSubset "},
+	{8848, "\\NotSquareSuperset "},
+	{8849, "\\sqsubseteq "},
+	{8850, "\\sqsupseteq "},
+	{8851, "\\sqcap "},
+	{8852, "\\sqcup "},
+	{8853, "\\oplus "},
+	{8854, "\\ominus "},
+	{8855, "\\otimes "},
+	{8856, "\\oslash "},
+	{8857, "\\odot "},
+	{8858, "\\circledcirc "},
+	{8859, "\\circledast "},
+	{8861, "\\circleddash "},
+	{8862, "\\boxplus "},
+	{8863, "\\boxminus "},
+	{8864, "\\boxtimes "},
+	{8865, "\\boxdot "},
+	{8866, "\\vdash "},
+	{8867, "\\dashv "},
+	{8868, "\\top "},
+	{8869, "\\perp "},
+	{8871, "\\truestate "},
+	{8872, "\\forcesextra "},
+	{8873, "\\Vdash "},
+	{8874, "\\Vvdash "},
+	{8875, "\\VDash "},
+	{8876, "\\nvdash "},
+	{8877, "\\nvDash "},
+	{8878, "\\nVdash "},
+	{8879, "\\nVDash "},
+	{8882, "\\vartriangleleft "},
+	{8883, "\\vartriangleright "},
+	{8884, "\\trianglelefteq "},
+	{8885, "\\trianglerighteq "},
+	{8886, "\\original "},
+	{8887, "\\image "},
+	{8888, "\\multimap "},
+	{8889, "\\hermitconjmatrix "},
+	{8890, "\\intercal "},
+	{8891, "\\veebar "},
+	{8894, "\\rightanglearc "},
+	{8896, "\\ElsevierGlyph{22C0}"},
+	{8897, "\\ElsevierGlyph{22C1}"},
+	{8898, "\\bigcap "},
+	{8899, "\\bigcup "},
+	{8900, "\\diamond "},
+	{8901, "\\cdot "},
+	{8902, "\\star "},
+	{8903, "\\divideontimes "},
+	{8904, "\\bowtie "},
+	{8905, "\\ltimes "},
+	{8906, "\\rtimes "},
+	{8907, "\\leftthreetimes "},
+	{8908, "\\rightthreetimes "},
+	{8909, "\\backsimeq "},
+	{8910, "\\curlyvee "},
+	{8911, "\\curlywedge "},
+	{8912, "\\Subset "},
+	{8913, "\\Supset "},
+	{8914, "\\Cap "},
+	{8915, "\\Cup "},
+	{8916, "\\pitchfork "},
+	{8918, "\\lessdot "},
+	{8919, "\\gtrdot "},
+	{8920, "\\verymuchless "},
+	{8921, "\\verymuchgreater "},
+	{8922, "\\lesseqgtr "},
+	{8923, "\\gtreqless "},
+	{8926, "\\curlyeqprec "},
+	{8927, "\\curlyeqsucc "},
+	{8930, "\\not\\sqsubseteq "},
+	{8931, "\\not\\sqsupseteq "},
+	{8933, "\\Elzsqspne "},
+	{8934, "\\lnsim "},
+	{8935, "\\gnsim "},
+	{8936, "\\precedesnotsimilar "},
+	{8937, "\\succnsim "},
+	{8938, "\\ntriangleleft "},
+	{8939, "\\ntriangleright "},
+	{8940, "\\ntrianglelefteq "},
+	{8941, "\\ntrianglerighteq "},
+	{8942, "\\vdots "},
+	{8943, "\\cdots "},
+	{8944, "\\upslopeellipsis "},
+	{8945, "\\downslopeellipsis "},
+	{8965, "\\barwedge "},
+	{8966, "\\perspcorrespond "},
+	{8968, "\\lceil "},
+	{8969, "\\rceil "},
+	{8970, "\\lfloor "},
+	{8971, "\\rfloor "},
+	{8981, "\\recorder "},
+	{8982, "\\mathchar\"2208"},
+	{8988, "\\ulcorner "},
+	{8989, "\\urcorner "},
+	{8990, "\\llcorner "},
+	{8991, "\\lrcorner "},
+	{8994, "\\frown "},
+	{8995, "\\smile "},
+	{9001, "\\langle "},
+	{9002, "\\rangle "},
+	{9021, "\\ElsevierGlyph{E838}"},
+	{9123, "\\Elzdlcorn "},
+	{9136, "\\lmoustache "},
+	{9137, "\\rmoustache "},
+	{9251, "\\textvisiblespace "},
+	{9312, "\\ding{172}"},
+	{9313, "\\ding{173}"},
+	{9314, "\\ding{174}"},
+	{9315, "\\ding{175}"},
+	{9316, "\\ding{176}"},
+	{9317, "\\ding{177}"},
+	{9318, "\\ding{178}"},
+	{9319, "\\ding{179}"},
+	{9320, "\\ding{180}"},
+	{9321, "\\ding{181}"},
+	{9416, "\\circledS "},
+	{9478, "\\Elzdshfnc "},
+	{9497, "\\Elzsqfnw "},
+	{9585, "\\diagup "},
+	{9632, "\\ding{110}"},
+	{9633, "\\square "},
+	{9642, "\\blacksquare "},
+	{9645, "\\fbox{~~}"},
+	{9647, "\\Elzvrecto "},
+	{9649, "\\ElsevierGlyph{E381}"},
+	{9650, "\\ding{115}"},
+	{9651, "\\bigtriangleup "},
+	{9652, "\\blacktriangle "},
+	{9653, "\\vartriangle "},
+	{9656, "\\blacktriangleright "},
+	{9657, "\\triangleright "},
+	{9660, "\\ding{116}"},
+	{9661, "\\bigtriangledown "},
+	{9662, "\\blacktriangledown "},
+	{9663, "\\triangledown "},
+	{9666, "\\blacktriangleleft "},
+	{9667, "\\triangleleft "},
+	{9670, "\\ding{117}"},
+	{9674, "\\lozenge "},
+	{9675, "\\bigcirc "},
+	{9679, "\\ding{108}"},
+	{9680, "\\Elzcirfl "},
+	{9681, "\\Elzcirfr "},
+	{9682, "\\Elzcirfb "},
+	{9687, "\\ding{119}"},
+	{9688, "\\Elzrvbull "},
+	{9703, "\\Elzsqfl "},
+	{9704, "\\Elzsqfr "},
+	{9706, "\\Elzsqfse "},
+	{9711, "\\bigcirc "},
+	{9733, "\\ding{72}"},
+	{9734, "\\ding{73}"},
+	{9742, "\\ding{37}"},
+	{9755, "\\ding{42}"},
+	{9758, "\\ding{43}"},
+	{9790, "\\rightmoon "},
+	{9791, "\\mercury "},
+	{9792, "\\venus "},
+	{9794, "\\male "},
+	{9795, "\\jupiter "},
+	{9796, "\\saturn "},
+	{9797, "\\uranus "},
+	{9798, "\\neptune "},
+	{9799, "\\pluto "},
+	{9800, "\\aries "},
+	{9801, "\\taurus "},
+	{9802, "\\gemini "},
+	{9803, "\\cancer "},
+	{9804, "\\leo "},
+	{9805, "\\virgo "},
+	{9806, "\\libra "},
+	{9807, "\\scorpio "},
+	{9808, "\\sagittarius "},
+	{9809, "\\capricornus "},
+	{9810, "\\aquarius "},
+	{9811, "\\pisces "},
+	{9824, "\\ding{171}"},
+	{9826, "\\diamond "},
+	{9827, "\\ding{168}"},
+	{9829, "\\ding{170}"},
+	{9830, "\\ding{169}"},
+	{9833, "\\quarternote "},
+	{9834, "\\eighthnote "},
+	{9837, "\\flat "},
+	{9838, "\\natural "},
+	{9839, "\\sharp "},
+	{9985, "\\ding{33}"},
+	{9986, "\\ding{34}"},
+	{9987, "\\ding{35}"},
+	{9988, "\\ding{36}"},
+	{9990, "\\ding{38}"},
+	{9991, "\\ding{39}"},
+	{9992, "\\ding{40}"},
+	{9993, "\\ding{41}"},
+	{9996, "\\ding{44}"},
+	{9997, "\\ding{45}"},
+	{9998, "\\ding{46}"},
+	{9999, "\\ding{47}"},
+	{10000, "\\ding{48}"},
+	{10001, "\\ding{49}"},
+	{10002, "\\ding{50}"},
+	{10003, "\\ding{51}"},
+	{10004, "\\ding{52}"},
+	{10005, "\\ding{53}"},
+	{10006, "\\ding{54}"},
+	{10007, "\\ding{55}"},
+	{10008, "\\ding{56}"},
+	{10009, "\\ding{57}"},
+	{10010, "\\ding{58}"},
+	{10011, "\\ding{59}"},
+	{10012, "\\ding{60}"},
+	{10013, "\\ding{61}"},
+	{10014, "\\ding{62}"},
+	{10015, "\\ding{63}"},
+	{10016, "\\ding{64}"},
+	{10017, "\\ding{65}"},
+	{10018, "\\ding{66}"},
+	{10019, "\\ding{67}"},
+	{10020, "\\ding{68}"},
+	{10021, "\\ding{69}"},
+	{10022, "\\ding{70}"},
+	{10023, "\\ding{71}"},
+	{10025, "\\ding{73}"},
+	{10026, "\\ding{74}"},
+	{10027, "\\ding{75}"},
+	{10028, "\\ding{76}"},
+	{10029, "\\ding{77}"},
+	{10030, "\\ding{78}"},
+	{10031, "\\ding{79}"},
+	{10032, "\\ding{80}"},
+	{10033, "\\ding{81}"},
+	{10034, "\\ding{82}"},
+	{10035, "\\ding{83}"},
+	{10036, "\\ding{84}"},
+	{10037, "\\ding{85}"},
+	{10038, "\\ding{86}"},
+	{10039, "\\ding{87}"},
+	{10040, "\\ding{88}"},
+	{10041, "\\ding{89}"},
+	{10042, "\\ding{90}"},
+	{10043, "\\ding{91}"},
+	{10044, "\\ding{92}"},
+	{10045, "\\ding{93}"},
+	{10046, "\\ding{94}"},
+	{10047, "\\ding{95}"},
+	{10048, "\\ding{96}"},
+	{10049, "\\ding{97}"},
+	{10050, "\\ding{98}"},
+	{10051, "\\ding{99}"},
+	{10052, "\\ding{100}"},
+	{10053, "\\ding{101}"},
+	{10054, "\\ding{102}"},
+	{10055, "\\ding{103}"},
+	{10056, "\\ding{104}"},
+	{10057, "\\ding{105}"},
+	{10058, "\\ding{106}"},
+	{10059, "\\ding{107}"},
+	{10061, "\\ding{109}"},
+	{10063, "\\ding{111}"},
+	{10064, "\\ding{112}"},
+	{10065, "\\ding{113}"},
+	{10066, "\\ding{114}"},
+	{10070, "\\ding{118}"},
+	{10072, "\\ding{120}"},
+	{10073, "\\ding{121}"},
+	{10074, "\\ding{122}"},
+	{10075, "\\ding{123}"},
+	{10076, "\\ding{124}"},
+	{10077, "\\ding{125}"},
+	{10078, "\\ding{126}"},
+	{10081, "\\ding{161}"},
+	{10082, "\\ding{162}"},
+	{10083, "\\ding{163}"},
+	{10084, "\\ding{164}"},
+	{10085, "\\ding{165}"},
+	{10086, "\\ding{166}"},
+	{10087, "\\ding{167}"},
+	{10102, "\\ding{182}"},
+	{10103, "\\ding{183}"},
+	{10104, "\\ding{184}"},
+	{10105, "\\ding{185}"},
+	{10106, "\\ding{186}"},
+	{10107, "\\ding{187}"},
+	{10108, "\\ding{188}"},
+	{10109, "\\ding{189}"},
+	{10110, "\\ding{190}"},
+	{10111, "\\ding{191}"},
+	{10112, "\\ding{192}"},
+	{10113, "\\ding{193}"},
+	{10114, "\\ding{194}"},
+	{10115, "\\ding{195}"},
+	{10116, "\\ding{196}"},
+	{10117, "\\ding{197}"},
+	{10118, "\\ding{198}"},
+	{10119, "\\ding{199}"},
+	{10120, "\\ding{200}"},
+	{10121, "\\ding{201}"},
+	{10122, "\\ding{202}"},
+	{10123, "\\ding{203}"},
+	{10124, "\\ding{204}"},
+	{10125, "\\ding{205}"},
+	{10126, "\\ding{206}"},
+	{10127, "\\ding{207}"},
+	{10128, "\\ding{208}"},
+	{10129, "\\ding{209}"},
+	{10130, "\\ding{210}"},
+	{10131, "\\ding{211}"},
+	{10132, "\\ding{212}"},
+	{10136, "\\ding{216}"},
+	{10137, "\\ding{217}"},
+	{10138, "\\ding{218}"},
+	{10139, "\\ding{219}"},
+	{10140, "\\ding{220}"},
+	{10141, "\\ding{221}"},
+	{10142, "\\ding{222}"},
+	{10143, "\\ding{223}"},
+	{10144, "\\ding{224}"},
+	{10145, "\\ding{225}"},
+	{10146, "\\ding{226}"},
+	{10147, "\\ding{227}"},
+	{10148, "\\ding{228}"},
+	{10149, "\\ding{229}"},
+	{10150, "\\ding{230}"},
+	{10151, "\\ding{231}"},
+	{10152, "\\ding{232}"},
+	{10153, "\\ding{233}"},
+	{10154, "\\ding{234}"},
+	{10155, "\\ding{235}"},
+	{10156, "\\ding{236}"},
+	{10157, "\\ding{237}"},
+	{10158, "\\ding{238}"},
+	{10159, "\\ding{239}"},
+	{10161, "\\ding{241}"},
+	{10162, "\\ding{242}"},
+	{10163, "\\ding{243}"},
+	{10164, "\\ding{244}"},
+	{10165, "\\ding{245}"},
+	{10166, "\\ding{246}"},
+	{10167, "\\ding{247}"},
+	{10168, "\\ding{248}"},
+	{10169, "\\ding{249}"},
+	{10170, "\\ding{250}"},
+	{10171, "\\ding{251}"},
+	{10172, "\\ding{252}"},
+	{10173, "\\ding{253}"},
+	{10174, "\\ding{254}"},
+	{10229, "\\longleftarrow "},
+	{10230, "\\longrightarrow "},
+	{10231, "\\longleftrightarrow "},
+	{10232, "\\Longleftarrow "},
+	{10233, "\\Longrightarrow "},
+	{10234, "\\Longleftrightarrow "},
+	{10236, "\\longmapsto "},
+	{10239, "\\sim\\joinrel\\leadsto"},
+	{10501, "\\ElsevierGlyph{E212}"},
+	{10514, "\\UpArrowBar "},
+	{10515, "\\DownArrowBar "},
+	{10531, "\\ElsevierGlyph{E20C}"},
+	{10532, "\\ElsevierGlyph{E20D}"},
+	{10533, "\\ElsevierGlyph{E20B}"},
+	{10534, "\\ElsevierGlyph{E20A}"},
+	{10535, "\\ElsevierGlyph{E211}"},
+	{10536, "\\ElsevierGlyph{E20E}"},
+	{10537, "\\ElsevierGlyph{E20F}"},
+	{10538, "\\ElsevierGlyph{E210}"},
+	{10547, "\\ElsevierGlyph{E21D}"},
+	{10550, "\\ElsevierGlyph{E21A}"},
+	{10551, "\\ElsevierGlyph{E219}"},
+	{10560, "\\Elolarr "},
+	{10561, "\\Elorarr "},
+	{10562, "\\ElzRlarr "},
+	{10564, "\\ElzrLarr "},
+	{10567, "\\Elzrarrx "},
+	{10574, "\\LeftRightVector "},
+	{10575, "\\RightUpDownVector "},
+	{10576, "\\DownLeftRightVector "},
+	{10577, "\\LeftUpDownVector "},
+	{10578, "\\LeftVectorBar "},
+	{10579, "\\RightVectorBar "},
+	{10580, "\\RightUpVectorBar "},
+	{10581, "\\RightDownVectorBar "},
+	{10582, "\\DownLeftVectorBar "},
+	{10583, "\\DownRightVectorBar "},
+	{10584, "\\LeftUpVectorBar "},
+	{10585, "\\LeftDownVectorBar "},
+	{10586, "\\LeftTeeVector "},
+	{10587, "\\RightTeeVector "},
+	{10588, "\\RightUpTeeVector "},
+	{10589, "\\RightDownTeeVector "},
+	{10590, "\\DownLeftTeeVector "},
+	{10591, "\\DownRightTeeVector "},
+	{10592, "\\LeftUpTeeVector "},
+	{10593, "\\LeftDownTeeVector "},
+	{10606, "\\UpEquilibrium "},
+	{10607, "\\ReverseUpEquilibrium "},
+	{10608, "\\RoundImplies "},
+	{10620, "\\ElsevierGlyph{E214}"},
+	{10621, "\\ElsevierGlyph{E215}"},
+	{10624, "\\Elztfnc "},
+	{10629, "\\ElsevierGlyph{3018}"},
+	{10630, "\\Elroang "},
+	{10643, "&lt;\\kern-0.58em("},
+	{10644, "\\ElsevierGlyph{E291}"},
+	{10649, "\\Elzddfnc "},
+	{10652, "\\Angle "},
+	{10656, "\\Elzlpargt "},
+	{10677, "\\ElsevierGlyph{E260}"},
+	{10678, "\\ElsevierGlyph{E61B}"},
+	{10698, "\\ElzLap "},
+	{10699, "\\Elzdefas "},
+	{10703, "\\NotLeftTriangleBar "},
+	{10704, "\\NotRightTriangleBar "},
+	{10716, "\\ElsevierGlyph{E372}"},
+	{10731, "\\blacklozenge "},
+	{10740, "\\RuleDelayed "},
+	{10756, "\\Elxuplus "},
+	{10757, "\\ElzThr "},
+	{10758, "\\Elxsqcup "},
+	{10759, "\\ElzInf "},
+	{10760, "\\ElzSup "},
+	{10765, "\\ElzCint "},
+	{10767, "\\clockoint "},
+	{10768, "\\ElsevierGlyph{E395}"},
+	{10774, "\\sqrint "},
+	{10789, "\\ElsevierGlyph{E25A}"},
+	{10794, "\\ElsevierGlyph{E25B}"},
+	{10797, "\\ElsevierGlyph{E25C}"},
+	{10798, "\\ElsevierGlyph{E25D}"},
+	{10799, "\\ElzTimes "},
+	{10804, "\\ElsevierGlyph{E25E}"},
+	{10805, "\\ElsevierGlyph{E25E}"},
+	{10812, "\\ElsevierGlyph{E259}"},
+	{10815, "\\amalg "},
+	{10835, "\\ElzAnd "},
+	{10836, "\\ElzOr "},
+	{10837, "\\ElsevierGlyph{E36E}"},
+	{10838, "\\ElOr "},
+	{10846, "\\perspcorrespond "},
+	{10847, "\\Elzminhat "},
+	{10851, "\\ElsevierGlyph{225A}"},
+	{10862, "\\stackrel{*}{=}"},
+	{10869, "\\Equal "},
+	{10877, "\\nleqslant "},
+	{10878, "\\ngeqslant "},
+	{10885, "\\lessapprox "},
+	{10886, "\\gtrapprox "},
+	{10887, "\\lneq "},
+	{10888, "\\gneq "},
+	{10889, "\\lnapprox "},
+	{10890, "\\gnapprox "},
+	{10891, "\\lesseqqgtr "},
+	{10892, "\\gtreqqless "},
+	{10901, "\\eqslantless "},
+	{10902, "\\eqslantgtr "},
+	{10909, "\\Pisymbol{ppi020}{117}"},
+	{10910, "\\Pisymbol{ppi020}{105}"},
+	{10913, "\\NotNestedLessLess "},
+	{10914, "\\NotNestedGreaterGreater "},
+	{10927, "\\not\\preceq "},
+	{10928, "\\not\\succeq "},
+	{10933, "\\precneqq "},
+	{10934, "\\succneqq "},
+	{10935, "\\precapprox "},
+	{10936, "\\succapprox "},
+	{10937, "\\precnapprox "},
+	{10938, "\\succnapprox "},
+	{10949, "\\nsubseteqq "},
+	{10950, "\\nsupseteqq"},
+	{10955, "\\subsetneqq "},
+	{10956, "\\supsetneqq "},
+	{10987, "\\ElsevierGlyph{E30D}"},
+	{10998, "\\Elztdcol "},
+	{11005, "{\\rlap{\\textbackslash}{{/}\\!\\!{/}}}"},
+	{12298, "\\ElsevierGlyph{300A}"},
+	{12299, "\\ElsevierGlyph{300B}"},
+	{12312, "\\ElsevierGlyph{3018}"},
+	{12313, "\\ElsevierGlyph{3019}"},
+	{12314, "\\openbracketleft "},
+	{12315, "\\openbracketright "},
+	{54272, "\\mathbf{A}"},
+	{54273, "\\mathbf{B}"},
+	{54274, "\\mathbf{C}"},
+	{54275, "\\mathbf{D}"},
+	{54276, "\\mathbf{E}"},
+	{54277, "\\mathbf{F}"},
+	{54278, "\\mathbf{G}"},
+	{54279, "\\mathbf{H}"},
+	{54280, "\\mathbf{I}"},
+	{54281, "\\mathbf{J}"},
+	{54282, "\\mathbf{K}"},
+	{54283, "\\mathbf{L}"},
+	{54284, "\\mathbf{M}"},
+	{54285, "\\mathbf{N}"},
+	{54286, "\\mathbf{O}"},
+	{54287, "\\mathbf{P}"},
+	{54288, "\\mathbf{Q}"},
+	{54289, "\\mathbf{R}"},
+	{54290, "\\mathbf{S}"},
+	{54291, "\\mathbf{T}"},
+	{54292, "\\mathbf{U}"},
+	{54293, "\\mathbf{V}"},
+	{54294, "\\mathbf{W}"},
+	{54295, "\\mathbf{X}"},
+	{54296, "\\mathbf{Y}"},
+	{54297, "\\mathbf{Z}"},
+	{54298, "\\mathbf{a}"},
+	{54299, "\\mathbf{b}"},
+	{54300, "\\mathbf{c}"},
+	{54301, "\\mathbf{d}"},
+	{54302, "\\mathbf{e}"},
+	{54303, "\\mathbf{f}"},
+	{54304, "\\mathbf{g}"},
+	{54305, "\\mathbf{h}"},
+	{54306, "\\mathbf{i}"},
+	{54307, "\\mathbf{j}"},
+	{54308, "\\mathbf{k}"},
+	{54309, "\\mathbf{l}"},
+	{54310, "\\mathbf{m}"},
+	{54311, "\\mathbf{n}"},
+	{54312, "\\mathbf{o}"},
+	{54313, "\\mathbf{p}"},
+	{54314, "\\mathbf{q}"},
+	{54315, "\\mathbf{r}"},
+	{54316, "\\mathbf{s}"},
+	{54317, "\\mathbf{t}"},
+	{54318, "\\mathbf{u}"},
+	{54319, "\\mathbf{v}"},
+	{54320, "\\mathbf{w}"},
+	{54321, "\\mathbf{x}"},
+	{54322, "\\mathbf{y}"},
+	{54323, "\\mathbf{z}"},
+	{54324, "\\mathsl{A}"},
+	{54325, "\\mathsl{B}"},
+	{54326, "\\mathsl{C}"},
+	{54327, "\\mathsl{D}"},
+	{54328, "\\mathsl{E}"},
+	{54329, "\\mathsl{F}"},
+	{54330, "\\mathsl{G}"},
+	{54331, "\\mathsl{H}"},
+	{54332, "\\mathsl{I}"},
+	{54333, "\\mathsl{J}"},
+	{54334, "\\mathsl{K}"},
+	{54335, "\\mathsl{L}"},
+	{54336, "\\mathsl{M}"},
+	{54337, "\\mathsl{N}"},
+	{54338, "\\mathsl{O}"},
+	{54339, "\\mathsl{P}"},
+	{54340, "\\mathsl{Q}"},
+	{54341, "\\mathsl{R}"},
+	{54342, "\\mathsl{S}"},
+	{54343, "\\mathsl{T}"},
+	{54344, "\\mathsl{U}"},
+	{54345, "\\mathsl{V}"},
+	{54346, "\\mathsl{W}"},
+	{54347, "\\mathsl{X}"},
+	{54348, "\\mathsl{Y}"},
+	{54349, "\\mathsl{Z}"},
+	{54350, "\\mathsl{a}"},
+	{54351, "\\mathsl{b}"},
+	{54352, "\\mathsl{c}"},
+	{54353, "\\mathsl{d}"},
+	{54354, "\\mathsl{e}"},
+	{54355, "\\mathsl{f}"},
+	{54356, "\\mathsl{g}"},
+	{54358, "\\mathsl{i}"},
+	{54359, "\\mathsl{j}"},
+	{54360, "\\mathsl{k}"},
+	{54361, "\\mathsl{l}"},
+	{54362, "\\mathsl{m}"},
+	{54363, "\\mathsl{n}"},
+	{54364, "\\mathsl{o}"},
+	{54365, "\\mathsl{p}"},
+	{54366, "\\mathsl{q}"},
+	{54367, "\\mathsl{r}"},
+	{54368, "\\mathsl{s}"},
+	{54369, "\\mathsl{t}"},
+	{54370, "\\mathsl{u}"},
+	{54371, "\\mathsl{v}"},
+	{54372, "\\mathsl{w}"},
+	{54373, "\\mathsl{x}"},
+	{54374, "\\mathsl{y}"},
+	{54375, "\\mathsl{z}"},
+	{54376, "\\mathbit{A}"},
+	{54377, "\\mathbit{B}"},
+	{54378, "\\mathbit{C}"},
+	{54379, "\\mathbit{D}"},
+	{54380, "\\mathbit{E}"},
+	{54381, "\\mathbit{F}"},
+	{54382, "\\mathbit{G}"},
+	{54383, "\\mathbit{H}"},
+	{54384, "\\mathbit{I}"},
+	{54385, "\\mathbit{J}"},
+	{54386, "\\mathbit{K}"},
+	{54387, "\\mathbit{L}"},
+	{54388, "\\mathbit{M}"},
+	{54389, "\\mathbit{N}"},
+	{54390, "\\mathbit{O}"},
+	{54391, "\\mathbit{P}"},
+	{54392, "\\mathbit{Q}"},
+	{54393, "\\mathbit{R}"},
+	{54394, "\\mathbit{S}"},
+	{54395, "\\mathbit{T}"},
+	{54396, "\\mathbit{U}"},
+	{54397, "\\mathbit{V}"},
+	{54398, "\\mathbit{W}"},
+	{54399, "\\mathbit{X}"},
+	{54400, "\\mathbit{Y}"},
+	{54401, "\\mathbit{Z}"},
+	{54402, "\\mathbit{a}"},
+	{54403, "\\mathbit{b}"},
+	{54404, "\\mathbit{c}"},
+	{54405, "\\mathbit{d}"},
+	{54406, "\\mathbit{e}"},
+	{54407, "\\mathbit{f}"},
+	{54408, "\\mathbit{g}"},
+	{54409, "\\mathbit{h}"},
+	{54410, "\\mathbit{i}"},
+	{54411, "\\mathbit{j}"},
+	{54412, "\\mathbit{k}"},
+	{54413, "\\mathbit{l}"},
+	{54414, "\\mathbit{m}"},
+	{54415, "\\mathbit{n}"},
+	{54416, "\\mathbit{o}"},
+	{54417, "\\mathbit{p}"},
+	{54418, "\\mathbit{q}"},
+	{54419, "\\mathbit{r}"},
+	{54420, "\\mathbit{s}"},
+	{54421, "\\mathbit{t}"},
+	{54422, "\\mathbit{u}"},
+	{54423, "\\mathbit{v}"},
+	{54424, "\\mathbit{w}"},
+	{54425, "\\mathbit{x}"},
+	{54426, "\\mathbit{y}"},
+	{54427, "\\mathbit{z}"},
+	{54428, "\\mathscr{A}"},
+	{54430, "\\mathscr{C}"},
+	{54431, "\\mathscr{D}"},
+	{54434, "\\mathscr{G}"},
+	{54437, "\\mathscr{J}"},
+	{54438, "\\mathscr{K}"},
+	{54441, "\\mathscr{N}"},
+	{54442, "\\mathscr{O}"},
+	{54443, "\\mathscr{P}"},
+	{54444, "\\mathscr{Q}"},
+	{54446, "\\mathscr{S}"},
+	{54447, "\\mathscr{T}"},
+	{54448, "\\mathscr{U}"},
+	{54449, "\\mathscr{V}"},
+	{54450, "\\mathscr{W}"},
+	{54451, "\\mathscr{X}"},
+	{54452, "\\mathscr{Y}"},
+	{54453, "\\mathscr{Z}"},
+	{54454, "\\mathscr{a}"},
+	{54455, "\\mathscr{b}"},
+	{54456, "\\mathscr{c}"},
+	{54457, "\\mathscr{d}"},
+	{54459, "\\mathscr{f}"},
+	{54461, "\\mathscr{h}"},
+	{54462, "\\mathscr{i}"},
+	{54463, "\\mathscr{j}"},
+	{54464, "\\mathscr{k}"},
+	{54465, "\\mathscr{l}"},
+	{54466, "\\mathscr{m}"},
+	{54467, "\\mathscr{n}"},
+	{54469, "\\mathscr{p}"},
+	{54470, "\\mathscr{q}"},
+	{54471, "\\mathscr{r}"},
+	{54472, "\\mathscr{s}"},
+	{54473, "\\mathscr{t}"},
+	{54474, "\\mathscr{u}"},
+	{54475, "\\mathscr{v}"},
+	{54476, "\\mathscr{w}"},
+	{54477, "\\mathscr{x}"},
+	{54478, "\\mathscr{y}"},
+	{54479, "\\mathscr{z}"},
+	{54480, "\\mathmit{A}"},
+	{54481, "\\mathmit{B}"},
+	{54482, "\\mathmit{C}"},
+	{54483, "\\mathmit{D}"},
+	{54484, "\\mathmit{E}"},
+	{54485, "\\mathmit{F}"},
+	{54486, "\\mathmit{G}"},
+	{54487, "\\mathmit{H}"},
+	{54488, "\\mathmit{I}"},
+	{54489, "\\mathmit{J}"},
+	{54490, "\\mathmit{K}"},
+	{54491, "\\mathmit{L}"},
+	{54492, "\\mathmit{M}"},
+	{54493, "\\mathmit{N}"},
+	{54494, "\\mathmit{O}"},
+	{54495, "\\mathmit{P}"},
+	{54496, "\\mathmit{Q}"},
+	{54497, "\\mathmit{R}"},
+	{54498, "\\mathmit{S}"},
+	{54499, "\\mathmit{T}"},
+	{54500, "\\mathmit{U}"},
+	{54501, "\\mathmit{V}"},
+	{54502, "\\mathmit{W}"},
+	{54503, "\\mathmit{X}"},
+	{54504, "\\mathmit{Y}"},
+	{54505, "\\mathmit{Z}"},
+	{54506, "\\mathmit{a}"},
+	{54507, "\\mathmit{b}"},
+	{54508, "\\mathmit{c}"},
+	{54509, "\\mathmit{d}"},
+	{54510, "\\mathmit{e}"},
+	{54511, "\\mathmit{f}"},
+	{54512, "\\mathmit{g}"},
+	{54513, "\\mathmit{h}"},
+	{54514, "\\mathmit{i}"},
+	{54515, "\\mathmit{j}"},
+	{54516, "\\mathmit{k}"},
+	{54517, "\\mathmit{l}"},
+	{54518, "\\mathmit{m}"},
+	{54519, "\\mathmit{n}"},
+	{54520, "\\mathmit{o}"},
+	{54521, "\\mathmit{p}"},
+	{54522, "\\mathmit{q}"},
+	{54523, "\\mathmit{r}"},
+	{54524, "\\mathmit{s}"},
+	{54525, "\\mathmit{t}"},
+	{54526, "\\mathmit{u}"},
+	{54527, "\\mathmit{v}"},
+	{54528, "\\mathmit{w}"},
+	{54529, "\\mathmit{x}"},
+	{54530, "\\mathmit{y}"},
+	{54531, "\\mathmit{z}"},
+	{54532, "\\mathfrak{A}"},
+	{54533, "\\mathfrak{B}"},
+	{54535, "\\mathfrak{D}"},
+	{54536, "\\mathfrak{E}"},
+	{54537, "\\mathfrak{F}"},
+	{54538, "\\mathfrak{G}"},
+	{54541, "\\mathfrak{J}"},
+	{54542, "\\mathfrak{K}"},
+	{54543, "\\mathfrak{L}"},
+	{54544, "\\mathfrak{M}"},
+	{54545, "\\mathfrak{N}"},
+	{54546, "\\mathfrak{O}"},
+	{54547, "\\mathfrak{P}"},
+	{54548, "\\mathfrak{Q}"},
+	{54550, "\\mathfrak{S}"},
+	{54551, "\\mathfrak{T}"},
+	{54552, "\\mathfrak{U}"},
+	{54553, "\\mathfrak{V}"},
+	{54554, "\\mathfrak{W}"},
+	{54555, "\\mathfrak{X}"},
+	{54556, "\\mathfrak{Y}"},
+	{54558, "\\mathfrak{a}"},
+	{54559, "\\mathfrak{b}"},
+	{54560, "\\mathfrak{c}"},
+	{54561, "\\mathfrak{d}"},
+	{54562, "\\mathfrak{e}"},
+	{54563, "\\mathfrak{f}"},
+	{54564, "\\mathfrak{g}"},
+	{54565, "\\mathfrak{h}"},
+	{54566, "\\mathfrak{i}"},
+	{54567, "\\mathfrak{j}"},
+	{54568, "\\mathfrak{k}"},
+	{54569, "\\mathfrak{l}"},
+	{54570, "\\mathfrak{m}"},
+	{54571, "\\mathfrak{n}"},
+	{54572, "\\mathfrak{o}"},
+	{54573, "\\mathfrak{p}"},
+	{54574, "\\mathfrak{q}"},
+	{54575, "\\mathfrak{r}"},
+	{54576, "\\mathfrak{s}"},
+	{54577, "\\mathfrak{t}"},
+	{54578, "\\mathfrak{u}"},
+	{54579, "\\mathfrak{v}"},
+	{54580, "\\mathfrak{w}"},
+	{54581, "\\mathfrak{x}"},
+	{54582, "\\mathfrak{y}"},
+	{54583, "\\mathfrak{z}"},
+	{54584, "\\mathbb{A}"},
+	{54585, "\\mathbb{B}"},
+	{54587, "\\mathbb{D}"},
+	{54588, "\\mathbb{E}"},
+	{54589, "\\mathbb{F}"},
+	{54590, "\\mathbb{G}"},
+	{54592, "\\mathbb{I}"},
+	{54593, "\\mathbb{J}"},
+	{54594, "\\mathbb{K}"},
+	{54595, "\\mathbb{L}"},
+	{54596, "\\mathbb{M}"},
+	{54598, "\\mathbb{O}"},
+	{54602, "\\mathbb{S}"},
+	{54603, "\\mathbb{T}"},
+	{54604, "\\mathbb{U}"},
+	{54605, "\\mathbb{V}"},
+	{54606, "\\mathbb{W}"},
+	{54607, "\\mathbb{X}"},
+	{54608, "\\mathbb{Y}"},
+	{54610, "\\mathbb{a}"},
+	{54611, "\\mathbb{b}"},
+	{54612, "\\mathbb{c}"},
+	{54613, "\\mathbb{d}"},
+	{54614, "\\mathbb{e}"},
+	{54615, "\\mathbb{f}"},
+	{54616, "\\mathbb{g}"},
+	{54617, "\\mathbb{h}"},
+	{54618, "\\mathbb{i}"},
+	{54619, "\\mathbb{j}"},
+	{54620, "\\mathbb{k}"},
+	{54621, "\\mathbb{l}"},
+	{54622, "\\mathbb{m}"},
+	{54623, "\\mathbb{n}"},
+	{54624, "\\mathbb{o}"},
+	{54625, "\\mathbb{p}"},
+	{54626, "\\mathbb{q}"},
+	{54627, "\\mathbb{r}"},
+	{54628, "\\mathbb{s}"},
+	{54629, "\\mathbb{t}"},
+	{54630, "\\mathbb{u}"},
+	{54631, "\\mathbb{v}"},
+	{54632, "\\mathbb{w}"},
+	{54633, "\\mathbb{x}"},
+	{54634, "\\mathbb{y}"},
+	{54635, "\\mathbb{z}"},
+	{54636, "\\mathslbb{A}"},
+	{54637, "\\mathslbb{B}"},
+	{54638, "\\mathslbb{C}"},
+	{54639, "\\mathslbb{D}"},
+	{54640, "\\mathslbb{E}"},
+	{54641, "\\mathslbb{F}"},
+	{54642, "\\mathslbb{G}"},
+	{54643, "\\mathslbb{H}"},
+	{54644, "\\mathslbb{I}"},
+	{54645, "\\mathslbb{J}"},
+	{54646, "\\mathslbb{K}"},
+	{54647, "\\mathslbb{L}"},
+	{54648, "\\mathslbb{M}"},
+	{54649, "\\mathslbb{N}"},
+	{54650, "\\mathslbb{O}"},
+	{54651, "\\mathslbb{P}"},
+	{54652, "\\mathslbb{Q}"},
+	{54653, "\\mathslbb{R}"},
+	{54654, "\\mathslbb{S}"},
+	{54655, "\\mathslbb{T}"},
+	{54656, "\\mathslbb{U}"},
+	{54657, "\\mathslbb{V}"},
+	{54658, "\\mathslbb{W}"},
+	{54659, "\\mathslbb{X}"},
+	{54660, "\\mathslbb{Y}"},
+	{54661, "\\mathslbb{Z}"},
+	{54662, "\\mathslbb{a}"},
+	{54663, "\\mathslbb{b}"},
+	{54664, "\\mathslbb{c}"},
+	{54665, "\\mathslbb{d}"},
+	{54666, "\\mathslbb{e}"},
+	{54667, "\\mathslbb{f}"},
+	{54668, "\\mathslbb{g}"},
+	{54669, "\\mathslbb{h}"},
+	{54670, "\\mathslbb{i}"},
+	{54671, "\\mathslbb{j}"},
+	{54672, "\\mathslbb{k}"},
+	{54673, "\\mathslbb{l}"},
+	{54674, "\\mathslbb{m}"},
+	{54675, "\\mathslbb{n}"},
+	{54676, "\\mathslbb{o}"},
+	{54677, "\\mathslbb{p}"},
+	{54678, "\\mathslbb{q}"},
+	{54679, "\\mathslbb{r}"},
+	{54680, "\\mathslbb{s}"},
+	{54681, "\\mathslbb{t}"},
+	{54682, "\\mathslbb{u}"},
+	{54683, "\\mathslbb{v}"},
+	{54684, "\\mathslbb{w}"},
+	{54685, "\\mathslbb{x}"},
+	{54686, "\\mathslbb{y}"},
+	{54687, "\\mathslbb{z}"},
+	{54688, "\\mathsf{A}"},
+	{54689, "\\mathsf{B}"},
+	{54690, "\\mathsf{C}"},
+	{54691, "\\mathsf{D}"},
+	{54692, "\\mathsf{E}"},
+	{54693, "\\mathsf{F}"},
+	{54694, "\\mathsf{G}"},
+	{54695, "\\mathsf{H}"},
+	{54696, "\\mathsf{I}"},
+	{54697, "\\mathsf{J}"},
+	{54698, "\\mathsf{K}"},
+	{54699, "\\mathsf{L}"},
+	{54700, "\\mathsf{M}"},
+	{54701, "\\mathsf{N}"},
+	{54702, "\\mathsf{O}"},
+	{54703, "\\mathsf{P}"},
+	{54704, "\\mathsf{Q}"},
+	{54705, "\\mathsf{R}"},
+	{54706, "\\mathsf{S}"},
+	{54707, "\\mathsf{T}"},
+	{54708, "\\mathsf{U}"},
+	{54709, "\\mathsf{V}"},
+	{54710, "\\mathsf{W}"},
+	{54711, "\\mathsf{X}"},
+	{54712, "\\mathsf{Y}"},
+	{54713, "\\mathsf{Z}"},
+	{54714, "\\mathsf{a}"},
+	{54715, "\\mathsf{b}"},
+	{54716, "\\mathsf{c}"},
+	{54717, "\\mathsf{d}"},
+	{54718, "\\mathsf{e}"},
+	{54719, "\\mathsf{f}"},
+	{54720, "\\mathsf{g}"},
+	{54721, "\\mathsf{h}"},
+	{54722, "\\mathsf{i}"},
+	{54723, "\\mathsf{j}"},
+	{54724, "\\mathsf{k}"},
+	{54725, "\\mathsf{l}"},
+	{54726, "\\mathsf{m}"},
+	{54727, "\\mathsf{n}"},
+	{54728, "\\mathsf{o}"},
+	{54729, "\\mathsf{p}"},
+	{54730, "\\mathsf{q}"},
+	{54731, "\\mathsf{r}"},
+	{54732, "\\mathsf{s}"},
+	{54733, "\\mathsf{t}"},
+	{54734, "\\mathsf{u}"},
+	{54735, "\\mathsf{v}"},
+	{54736, "\\mathsf{w}"},
+	{54737, "\\mathsf{x}"},
+	{54738, "\\mathsf{y}"},
+	{54739, "\\mathsf{z}"},
+	{54740, "\\mathsfbf{A}"},
+	{54741, "\\mathsfbf{B}"},
+	{54742, "\\mathsfbf{C}"},
+	{54743, "\\mathsfbf{D}"},
+	{54744, "\\mathsfbf{E}"},
+	{54745, "\\mathsfbf{F}"},
+	{54746, "\\mathsfbf{G}"},
+	{54747, "\\mathsfbf{H}"},
+	{54748, "\\mathsfbf{I}"},
+	{54749, "\\mathsfbf{J}"},
+	{54750, "\\mathsfbf{K}"},
+	{54751, "\\mathsfbf{L}"},
+	{54752, "\\mathsfbf{M}"},
+	{54753, "\\mathsfbf{N}"},
+	{54754, "\\mathsfbf{O}"},
+	{54755, "\\mathsfbf{P}"},
+	{54756, "\\mathsfbf{Q}"},
+	{54757, "\\mathsfbf{R}"},
+	{54758, "\\mathsfbf{S}"},
+	{54759, "\\mathsfbf{T}"},
+	{54760, "\\mathsfbf{U}"},
+	{54761, "\\mathsfbf{V}"},
+	{54762, "\\mathsfbf{W}"},
+	{54763, "\\mathsfbf{X}"},
+	{54764, "\\mathsfbf{Y}"},
+	{54765, "\\mathsfbf{Z}"},
+	{54766, "\\mathsfbf{a}"},
+	{54767, "\\mathsfbf{b}"},
+	{54768, "\\mathsfbf{c}"},
+	{54769, "\\mathsfbf{d}"},
+	{54770, "\\mathsfbf{e}"},
+	{54771, "\\mathsfbf{f}"},
+	{54772, "\\mathsfbf{g}"},
+	{54773, "\\mathsfbf{h}"},
+	{54774, "\\mathsfbf{i}"},
+	{54775, "\\mathsfbf{j}"},
+	{54776, "\\mathsfbf{k}"},
+	{54777, "\\mathsfbf{l}"},
+	{54778, "\\mathsfbf{m}"},
+	{54779, "\\mathsfbf{n}"},
+	{54780, "\\mathsfbf{o}"},
+	{54781, "\\mathsfbf{p}"},
+	{54782, "\\mathsfbf{q}"},
+	{54783, "\\mathsfbf{r}"},
+	{54784, "\\mathsfbf{s}"},
+	{54785, "\\mathsfbf{t}"},
+	{54786, "\\mathsfbf{u}"},
+	{54787, "\\mathsfbf{v}"},
+	{54788, "\\mathsfbf{w}"},
+	{54789, "\\mathsfbf{x}"},
+	{54790, "\\mathsfbf{y}"},
+	{54791, "\\mathsfbf{z}"},
+	{54792, "\\mathsfsl{A}"},
+	{54793, "\\mathsfsl{B}"},
+	{54794, "\\mathsfsl{C}"},
+	{54795, "\\mathsfsl{D}"},
+	{54796, "\\mathsfsl{E}"},
+	{54797, "\\mathsfsl{F}"},
+	{54798, "\\mathsfsl{G}"},
+	{54799, "\\mathsfsl{H}"},
+	{54800, "\\mathsfsl{I}"},
+	{54801, "\\mathsfsl{J}"},
+	{54802, "\\mathsfsl{K}"},
+	{54803, "\\mathsfsl{L}"},
+	{54804, "\\mathsfsl{M}"},
+	{54805, "\\mathsfsl{N}"},
+	{54806, "\\mathsfsl{O}"},
+	{54807, "\\mathsfsl{P}"},
+	{54808, "\\mathsfsl{Q}"},
+	{54809, "\\mathsfsl{R}"},
+	{54810, "\\mathsfsl{S}"},
+	{54811, "\\mathsfsl{T}"},
+	{54812, "\\mathsfsl{U}"},
+	{54813, "\\mathsfsl{V}"},
+	{54814, "\\mathsfsl{W}"},
+	{54815, "\\mathsfsl{X}"},
+	{54816, "\\mathsfsl{Y}"},
+	{54817, "\\mathsfsl{Z}"},
+	{54818, "\\mathsfsl{a}"},
+	{54819, "\\mathsfsl{b}"},
+	{54820, "\\mathsfsl{c}"},
+	{54821, "\\mathsfsl{d}"},
+	{54822, "\\mathsfsl{e}"},
+	{54823, "\\mathsfsl{f}"},
+	{54824, "\\mathsfsl{g}"},
+	{54825, "\\mathsfsl{h}"},
+	{54826, "\\mathsfsl{i}"},
+	{54827, "\\mathsfsl{j}"},
+	{54828, "\\mathsfsl{k}"},
+	{54829, "\\mathsfsl{l}"},
+	{54830, "\\mathsfsl{m}"},
+	{54831, "\\mathsfsl{n}"},
+	{54832, "\\mathsfsl{o}"},
+	{54833, "\\mathsfsl{p}"},
+	{54834, "\\mathsfsl{q}"},
+	{54835, "\\mathsfsl{r}"},
+	{54836, "\\mathsfsl{s}"},
+	{54837, "\\mathsfsl{t}"},
+	{54838, "\\mathsfsl{u}"},
+	{54839, "\\mathsfsl{v}"},
+	{54840, "\\mathsfsl{w}"},
+	{54841, "\\mathsfsl{x}"},
+	{54842, "\\mathsfsl{y}"},
+	{54843, "\\mathsfsl{z}"},
+	{54844, "\\mathsfbfsl{A}"},
+	{54845, "\\mathsfbfsl{B}"},
+	{54846, "\\mathsfbfsl{C}"},
+	{54847, "\\mathsfbfsl{D}"},
+	{54848, "\\mathsfbfsl{E}"},
+	{54849, "\\mathsfbfsl{F}"},
+	{54850, "\\mathsfbfsl{G}"},
+	{54851, "\\mathsfbfsl{H}"},
+	{54852, "\\mathsfbfsl{I}"},
+	{54853, "\\mathsfbfsl{J}"},
+	{54854, "\\mathsfbfsl{K}"},
+	{54855, "\\mathsfbfsl{L}"},
+	{54856, "\\mathsfbfsl{M}"},
+	{54857, "\\mathsfbfsl{N}"},
+	{54858, "\\mathsfbfsl{O}"},
+	{54859, "\\mathsfbfsl{P}"},
+	{54860, "\\mathsfbfsl{Q}"},
+	{54861, "\\mathsfbfsl{R}"},
+	{54862, "\\mathsfbfsl{S}"},
+	{54863, "\\mathsfbfsl{T}"},
+	{54864, "\\mathsfbfsl{U}"},
+	{54865, "\\mathsfbfsl{V}"},
+	{54866, "\\mathsfbfsl{W}"},
+	{54867, "\\mathsfbfsl{X}"},
+	{54868, "\\mathsfbfsl{Y}"},
+	{54869, "\\mathsfbfsl{Z}"},
+	{54870, "\\mathsfbfsl{a}"},
+	{54871, "\\mathsfbfsl{b}"},
+	{54872, "\\mathsfbfsl{c}"},
+	{54873, "\\mathsfbfsl{d}"},
+	{54874, "\\mathsfbfsl{e}"},
+	{54875, "\\mathsfbfsl{f}"},
+	{54876, "\\mathsfbfsl{g}"},
+	{54877, "\\mathsfbfsl{h}"},
+	{54878, "\\mathsfbfsl{i}"},
+	{54879, "\\mathsfbfsl{j}"},
+	{54880, "\\mathsfbfsl{k}"},
+	{54881, "\\mathsfbfsl{l}"},
+	{54882, "\\mathsfbfsl{m}"},
+	{54883, "\\mathsfbfsl{n}"},
+	{54884, "\\mathsfbfsl{o}"},
+	{54885, "\\mathsfbfsl{p}"},
+	{54886, "\\mathsfbfsl{q}"},
+	{54887, "\\mathsfbfsl{r}"},
+	{54888, "\\mathsfbfsl{s}"},
+	{54889, "\\mathsfbfsl{t}"},
+	{54890, "\\mathsfbfsl{u}"},
+	{54891, "\\mathsfbfsl{v}"},
+	{54892, "\\mathsfbfsl{w}"},
+	{54893, "\\mathsfbfsl{x}"},
+	{54894, "\\mathsfbfsl{y}"},
+	{54895, "\\mathsfbfsl{z}"},
+	{54896, "\\mathtt{A}"},
+	{54897, "\\mathtt{B}"},
+	{54898, "\\mathtt{C}"},
+	{54899, "\\mathtt{D}"},
+	{54900, "\\mathtt{E}"},
+	{54901, "\\mathtt{F}"},
+	{54902, "\\mathtt{G}"},
+	{54903, "\\mathtt{H}"},
+	{54904, "\\mathtt{I}"},
+	{54905, "\\mathtt{J}"},
+	{54906, "\\mathtt{K}"},
+	{54907, "\\mathtt{L}"},
+	{54908, "\\mathtt{M}"},
+	{54909, "\\mathtt{N}"},
+	{54910, "\\mathtt{O}"},
+	{54911, "\\mathtt{P}"},
+	{54912, "\\mathtt{Q}"},
+	{54913, "\\mathtt{R}"},
+	{54914, "\\mathtt{S}"},
+	{54915, "\\mathtt{T}"},
+	{54916, "\\mathtt{U}"},
+	{54917, "\\mathtt{V}"},
+	{54918, "\\mathtt{W}"},
+	{54919, "\\mathtt{X}"},
+	{54920, "\\mathtt{Y}"},
+	{54921, "\\mathtt{Z}"},
+	{54922, "\\mathtt{a}"},
+	{54923, "\\mathtt{b}"},
+	{54924, "\\mathtt{c}"},
+	{54925, "\\mathtt{d}"},
+	{54926, "\\mathtt{e}"},
+	{54927, "\\mathtt{f}"},
+	{54928, "\\mathtt{g}"},
+	{54929, "\\mathtt{h}"},
+	{54930, "\\mathtt{i}"},
+	{54931, "\\mathtt{j}"},
+	{54932, "\\mathtt{k}"},
+	{54933, "\\mathtt{l}"},
+	{54934, "\\mathtt{m}"},
+	{54935, "\\mathtt{n}"},
+	{54936, "\\mathtt{o}"},
+	{54937, "\\mathtt{p}"},
+	{54938, "\\mathtt{q}"},
+	{54939, "\\mathtt{r}"},
+	{54940, "\\mathtt{s}"},
+	{54941, "\\mathtt{t}"},
+	{54942, "\\mathtt{u}"},
+	{54943, "\\mathtt{v}"},
+	{54944, "\\mathtt{w}"},
+	{54945, "\\mathtt{x}"},
+	{54946, "\\mathtt{y}"},
+	{54947, "\\mathtt{z}"},
+	{54952, "\\mathbf{\\Alpha}"},
+	{54953, "\\mathbf{\\Beta}"},
+	{54954, "\\mathbf{\\Gamma}"},
+	{54955, "\\mathbf{\\Delta}"},
+	{54956, "\\mathbf{\\Epsilon}"},
+	{54957, "\\mathbf{\\Zeta}"},
+	{54958, "\\mathbf{\\Eta}"},
+	{54959, "\\mathbf{\\Theta}"},
+	{54960, "\\mathbf{\\Iota}"},
+	{54961, "\\mathbf{\\Kappa}"},
+	{54962, "\\mathbf{\\Lambda}"},
+	{54965, "\\mathbf{\\Xi}"},
+	{54967, "\\mathbf{\\Pi}"},
+	{54968, "\\mathbf{\\Rho}"},
+	{54969, "\\mathbf{\\vartheta}"},
+	{54970, "\\mathbf{\\Sigma}"},
+	{54971, "\\mathbf{\\Tau}"},
+	{54972, "\\mathbf{\\Upsilon}"},
+	{54973, "\\mathbf{\\Phi}"},
+	{54974, "\\mathbf{\\Chi}"},
+	{54975, "\\mathbf{\\Psi}"},
+	{54976, "\\mathbf{\\Omega}"},
+	{54977, "\\mathbf{\\nabla}"},
+	{54978, "\\mathbf{\\Alpha}"},
+	{54979, "\\mathbf{\\Beta}"},
+	{54980, "\\mathbf{\\Gamma}"},
+	{54981, "\\mathbf{\\Delta}"},
+	{54982, "\\mathbf{\\Epsilon}"},
+	{54983, "\\mathbf{\\Zeta}"},
+	{54984, "\\mathbf{\\Eta}"},
+	{54985, "\\mathbf{\\theta}"},
+	{54986, "\\mathbf{\\Iota}"},
+	{54987, "\\mathbf{\\Kappa}"},
+	{54988, "\\mathbf{\\Lambda}"},
+	{54991, "\\mathbf{\\Xi}"},
+	{54993, "\\mathbf{\\Pi}"},
+	{54994, "\\mathbf{\\Rho}"},
+	{54995, "\\mathbf{\\varsigma}"},
+	{54996, "\\mathbf{\\Sigma}"},
+	{54997, "\\mathbf{\\Tau}"},
+	{54998, "\\mathbf{\\Upsilon}"},
+	{54999, "\\mathbf{\\Phi}"},
+	{55000, "\\mathbf{\\Chi}"},
+	{55001, "\\mathbf{\\Psi}"},
+	{55002, "\\mathbf{\\Omega}"},
+	{55003, "\\partial "},
+	{55004, "\\in"},
+	{55005, "\\mathbf{\\vartheta}"},
+	{55006, "\\mathbf{\\varkappa}"},
+	{55007, "\\mathbf{\\phi}"},
+	{55008, "\\mathbf{\\varrho}"},
+	{55009, "\\mathbf{\\varpi}"},
+	{55010, "\\mathsl{\\Alpha}"},
+	{55011, "\\mathsl{\\Beta}"},
+	{55012, "\\mathsl{\\Gamma}"},
+	{55013, "\\mathsl{\\Delta}"},
+	{55014, "\\mathsl{\\Epsilon}"},
+	{55015, "\\mathsl{\\Zeta}"},
+	{55016, "\\mathsl{\\Eta}"},
+	{55017, "\\mathsl{\\Theta}"},
+	{55018, "\\mathsl{\\Iota}"},
+	{55019, "\\mathsl{\\Kappa}"},
+	{55020, "\\mathsl{\\Lambda}"},
+	{55023, "\\mathsl{\\Xi}"},
+	{55025, "\\mathsl{\\Pi}"},
+	{55026, "\\mathsl{\\Rho}"},
+	{55027, "\\mathsl{\\vartheta}"},
+	{55028, "\\mathsl{\\Sigma}"},
+	{55029, "\\mathsl{\\Tau}"},
+	{55030, "\\mathsl{\\Upsilon}"},
+	{55031, "\\mathsl{\\Phi}"},
+	{55032, "\\mathsl{\\Chi}"},
+	{55033, "\\mathsl{\\Psi}"},
+	{55034, "\\mathsl{\\Omega}"},
+	{55035, "\\mathsl{\\nabla}"},
+	{55036, "\\mathsl{\\Alpha}"},
+	{55037, "\\mathsl{\\Beta}"},
+	{55038, "\\mathsl{\\Gamma}"},
+	{55039, "\\mathsl{\\Delta}"},
+	{55040, "\\mathsl{\\Epsilon}"},
+	{55041, "\\mathsl{\\Zeta}"},
+	{55042, "\\mathsl{\\Eta}"},
+	{55043, "\\mathsl{\\Theta}"},
+	{55044, "\\mathsl{\\Iota}"},
+	{55045, "\\mathsl{\\Kappa}"},
+	{55046, "\\mathsl{\\Lambda}"},
+	{55049, "\\mathsl{\\Xi}"},
+	{55051, "\\mathsl{\\Pi}"},
+	{55052, "\\mathsl{\\Rho}"},
+	{55053, "\\mathsl{\\varsigma}"},
+	{55054, "\\mathsl{\\Sigma}"},
+	{55055, "\\mathsl{\\Tau}"},
+	{55056, "\\mathsl{\\Upsilon}"},
+	{55057, "\\mathsl{\\Phi}"},
+	{55058, "\\mathsl{\\Chi}"},
+	{55059, "\\mathsl{\\Psi}"},
+	{55060, "\\mathsl{\\Omega}"},
+	{55061, "\\partial "},
+	{55062, "\\in"},
+	{55063, "\\mathsl{\\vartheta}"},
+	{55064, "\\mathsl{\\varkappa}"},
+	{55065, "\\mathsl{\\phi}"},
+	{55066, "\\mathsl{\\varrho}"},
+	{55067, "\\mathsl{\\varpi}"},
+	{55068, "\\mathbit{\\Alpha}"},
+	{55069, "\\mathbit{\\Beta}"},
+	{55070, "\\mathbit{\\Gamma}"},
+	{55071, "\\mathbit{\\Delta}"},
+	{55072, "\\mathbit{\\Epsilon}"},
+	{55073, "\\mathbit{\\Zeta}"},
+	{55074, "\\mathbit{\\Eta}"},
+	{55075, "\\mathbit{\\Theta}"},
+	{55076, "\\mathbit{\\Iota}"},
+	{55077, "\\mathbit{\\Kappa}"},
+	{55078, "\\mathbit{\\Lambda}"},
+	{55081, "\\mathbit{\\Xi}"},
+	{55083, "\\mathbit{\\Pi}"},
+	{55084, "\\mathbit{\\Rho}"},
+	{55085, "\\mathbit{O}"},
+	{55086, "\\mathbit{\\Sigma}"},
+	{55087, "\\mathbit{\\Tau}"},
+	{55088, "\\mathbit{\\Upsilon}"},
+	{55089, "\\mathbit{\\Phi}"},
+	{55090, "\\mathbit{\\Chi}"},
+	{55091, "\\mathbit{\\Psi}"},
+	{55092, "\\mathbit{\\Omega}"},
+	{55093, "\\mathbit{\\nabla}"},
+	{55094, "\\mathbit{\\Alpha}"},
+	{55095, "\\mathbit{\\Beta}"},
+	{55096, "\\mathbit{\\Gamma}"},
+	{55097, "\\mathbit{\\Delta}"},
+	{55098, "\\mathbit{\\Epsilon}"},
+	{55099, "\\mathbit{\\Zeta}"},
+	{55100, "\\mathbit{\\Eta}"},
+	{55101, "\\mathbit{\\Theta}"},
+	{55102, "\\mathbit{\\Iota}"},
+	{55103, "\\mathbit{\\Kappa}"},
+	{55104, "\\mathbit{\\Lambda}"},
+	{55107, "\\mathbit{\\Xi}"},
+	{55109, "\\mathbit{\\Pi}"},
+	{55110, "\\mathbit{\\Rho}"},
+	{55111, "\\mathbit{\\varsigma}"},
+	{55112, "\\mathbit{\\Sigma}"},
+	{55113, "\\mathbit{\\Tau}"},
+	{55114, "\\mathbit{\\Upsilon}"},
+	{55115, "\\mathbit{\\Phi}"},
+	{55116, "\\mathbit{\\Chi}"},
+	{55117, "\\mathbit{\\Psi}"},
+	{55118, "\\mathbit{\\Omega}"},
+	{55119, "\\partial "},
+	{55120, "\\in"},
+	{55121, "\\mathbit{\\vartheta}"},
+	{55122, "\\mathbit{\\varkappa}"},
+	{55123, "\\mathbit{\\phi}"},
+	{55124, "\\mathbit{\\varrho}"},
+	{55125, "\\mathbit{\\varpi}"},
+	{55126, "\\mathsfbf{\\Alpha}"},
+	{55127, "\\mathsfbf{\\Beta}"},
+	{55128, "\\mathsfbf{\\Gamma}"},
+	{55129, "\\mathsfbf{\\Delta}"},
+	{55130, "\\mathsfbf{\\Epsilon}"},
+	{55131, "\\mathsfbf{\\Zeta}"},
+	{55132, "\\mathsfbf{\\Eta}"},
+	{55133, "\\mathsfbf{\\Theta}"},
+	{55134, "\\mathsfbf{\\Iota}"},
+	{55135, "\\mathsfbf{\\Kappa}"},
+	{55136, "\\mathsfbf{\\Lambda}"},
+	{55139, "\\mathsfbf{\\Xi}"},
+	{55141, "\\mathsfbf{\\Pi}"},
+	{55142, "\\mathsfbf{\\Rho}"},
+	{55143, "\\mathsfbf{\\vartheta}"},
+	{55144, "\\mathsfbf{\\Sigma}"},
+	{55145, "\\mathsfbf{\\Tau}"},
+	{55146, "\\mathsfbf{\\Upsilon}"},
+	{55147, "\\mathsfbf{\\Phi}"},
+	{55148, "\\mathsfbf{\\Chi}"},
+	{55149, "\\mathsfbf{\\Psi}"},
+	{55150, "\\mathsfbf{\\Omega}"},
+	{55151, "\\mathsfbf{\\nabla}"},
+	{55152, "\\mathsfbf{\\Alpha}"},
+	{55153, "\\mathsfbf{\\Beta}"},
+	{55154, "\\mathsfbf{\\Gamma}"},
+	{55155, "\\mathsfbf{\\Delta}"},
+	{55156, "\\mathsfbf{\\Epsilon}"},
+	{55157, "\\mathsfbf{\\Zeta}"},
+	{55158, "\\mathsfbf{\\Eta}"},
+	{55159, "\\mathsfbf{\\Theta}"},
+	{55160, "\\mathsfbf{\\Iota}"},
+	{55161, "\\mathsfbf{\\Kappa}"},
+	{55162, "\\mathsfbf{\\Lambda}"},
+	{55165, "\\mathsfbf{\\Xi}"},
+	{55167, "\\mathsfbf{\\Pi}"},
+	{55168, "\\mathsfbf{\\Rho}"},
+	{55169, "\\mathsfbf{\\varsigma}"},
+	{55170, "\\mathsfbf{\\Sigma}"},
+	{55171, "\\mathsfbf{\\Tau}"},
+	{55172, "\\mathsfbf{\\Upsilon}"},
+	{55173, "\\mathsfbf{\\Phi}"},
+	{55174, "\\mathsfbf{\\Chi}"},
+	{55175, "\\mathsfbf{\\Psi}"},
+	{55176, "\\mathsfbf{\\Omega}"},
+	{55177, "\\partial "},
+	{55178, "\\in"},
+	{55179, "\\mathsfbf{\\vartheta}"},
+	{55180, "\\mathsfbf{\\varkappa}"},
+	{55181, "\\mathsfbf{\\phi}"},
+	{55182, "\\mathsfbf{\\varrho}"},
+	{55183, "\\mathsfbf{\\varpi}"},
+	{55184, "\\mathsfbfsl{\\Alpha}"},
+	{55185, "\\mathsfbfsl{\\Beta}"},
+	{55186, "\\mathsfbfsl{\\Gamma}"},
+	{55187, "\\mathsfbfsl{\\Delta}"},
+	{55188, "\\mathsfbfsl{\\Epsilon}"},
+	{55189, "\\mathsfbfsl{\\Zeta}"},
+	{55190, "\\mathsfbfsl{\\Eta}"},
+	{55191, "\\mathsfbfsl{\\vartheta}"},
+	{55192, "\\mathsfbfsl{\\Iota}"},
+	{55193, "\\mathsfbfsl{\\Kappa}"},
+	{55194, "\\mathsfbfsl{\\Lambda}"},
+	{55197, "\\mathsfbfsl{\\Xi}"},
+	{55199, "\\mathsfbfsl{\\Pi}"},
+	{55200, "\\mathsfbfsl{\\Rho}"},
+	{55201, "\\mathsfbfsl{\\vartheta}"},
+	{55202, "\\mathsfbfsl{\\Sigma}"},
+	{55203, "\\mathsfbfsl{\\Tau}"},
+	{55204, "\\mathsfbfsl{\\Upsilon}"},
+	{55205, "\\mathsfbfsl{\\Phi}"},
+	{55206, "\\mathsfbfsl{\\Chi}"},
+	{55207, "\\mathsfbfsl{\\Psi}"},
+	{55208, "\\mathsfbfsl{\\Omega}"},
+	{55209, "\\mathsfbfsl{\\nabla}"},
+	{55210, "\\mathsfbfsl{\\Alpha}"},
+	{55211, "\\mathsfbfsl{\\Beta}"},
+	{55212, "\\mathsfbfsl{\\Gamma}"},
+	{55213, "\\mathsfbfsl{\\Delta}"},
+	{55214, "\\mathsfbfsl{\\Epsilon}"},
+	{55215, "\\mathsfbfsl{\\Zeta}"},
+	{55216, "\\mathsfbfsl{\\Eta}"},
+	{55217, "\\mathsfbfsl{\\vartheta}"},
+	{55218, "\\mathsfbfsl{\\Iota}"},
+	{55219, "\\mathsfbfsl{\\Kappa}"},
+	{55220, "\\mathsfbfsl{\\Lambda}"},
+	{55223, "\\mathsfbfsl{\\Xi}"},
+	{55225, "\\mathsfbfsl{\\Pi}"},
+	{55226, "\\mathsfbfsl{\\Rho}"},
+	{55227, "\\mathsfbfsl{\\varsigma}"},
+	{55228, "\\mathsfbfsl{\\Sigma}"},
+	{55229, "\\mathsfbfsl{\\Tau}"},
+	{55230, "\\mathsfbfsl{\\Upsilon}"},
+	{55231, "\\mathsfbfsl{\\Phi}"},
+	{55232, "\\mathsfbfsl{\\Chi}"},
+	{55233, "\\mathsfbfsl{\\Psi}"},
+	{55234, "\\mathsfbfsl{\\Omega}"},
+	{55235, "\\partial "},
+	{55236, "\\in"},
+	{55237, "\\mathsfbfsl{\\vartheta}"},
+	{55238, "\\mathsfbfsl{\\varkappa}"},
+	{55239, "\\mathsfbfsl{\\phi}"},
+	{55240, "\\mathsfbfsl{\\varrho}"},
+	{55241, "\\mathsfbfsl{\\varpi}"},
+	{55246, "\\mathbf{0}"},
+	{55247, "\\mathbf{1}"},
+	{55248, "\\mathbf{2}"},
+	{55249, "\\mathbf{3}"},
+	{55250, "\\mathbf{4}"},
+	{55251, "\\mathbf{5}"},
+	{55252, "\\mathbf{6}"},
+	{55253, "\\mathbf{7}"},
+	{55254, "\\mathbf{8}"},
+	{55255, "\\mathbf{9}"},
+	{55256, "\\mathbb{0}"},
+	{55257, "\\mathbb{1}"},
+	{55258, "\\mathbb{2}"},
+	{55259, "\\mathbb{3}"},
+	{55260, "\\mathbb{4}"},
+	{55261, "\\mathbb{5}"},
+	{55262, "\\mathbb{6}"},
+	{55263, "\\mathbb{7}"},
+	{55264, "\\mathbb{8}"},
+	{55265, "\\mathbb{9}"},
+	{55266, "\\mathsf{0}"},
+	{55267, "\\mathsf{1}"},
+	{55268, "\\mathsf{2}"},
+	{55269, "\\mathsf{3}"},
+	{55270, "\\mathsf{4}"},
+	{55271, "\\mathsf{5}"},
+	{55272, "\\mathsf{6}"},
+	{55273, "\\mathsf{7}"},
+	{55274, "\\mathsf{8}"},
+	{55275, "\\mathsf{9}"},
+	{55276, "\\mathsfbf{0}"},
+	{55277, "\\mathsfbf{1}"},
+	{55278, "\\mathsfbf{2}"},
+	{55279, "\\mathsfbf{3}"},
+	{55280, "\\mathsfbf{4}"},
+	{55281, "\\mathsfbf{5}"},
+	{55282, "\\mathsfbf{6}"},
+	{55283, "\\mathsfbf{7}"},
+	{55284, "\\mathsfbf{8}"},
+	{55285, "\\mathsfbf{9}"},
+	{55286, "\\mathtt{0}"},
+	{55287, "\\mathtt{1}"},
+	{55288, "\\mathtt{2}"},
+	{55289, "\\mathtt{3}"},
+	{55290, "\\mathtt{4}"},
+	{55291, "\\mathtt{5}"},
+	{55292, "\\mathtt{6}"},
+	{55293, "\\mathtt{7}"},
+	{55294, "\\mathtt{8}"},
+	{55295, "\\mathtt{9}"},
+	{64256, "ff"},
+	{64257, "fi"},
+	{64258, "fl"},
+	{64259, "ffi"},
+	{64260, "ffl"},
+};
+
+const size_t unicode_latex::substCount = sizeof(substTable) / sizeof(substTable[0]);
+
+// two-level index over substTable: substPages maps the high byte of a code point
+// to a row of substSlots (0 is the empty row), which maps the low byte to the
+// 1-based position in substTable (0 stands for no substitution)
+const unsigned char unicode_latex::substPages[256] = {
+	1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6, 7, 8, 9, 10, 11, 12, 13, 0, 14, 15, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0,
+};
+
+const unsigned short unicode_latex::substSlots[22][256] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 0, 0, 2, 3, 4, 5, 6, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 9, 10,
+		11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 14, 15, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+		47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+		79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+	},
+	{
+		111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+		143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+		175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+		207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241, 0, 0, 0, 0, 0,
+		0, 0, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 244, 0, 245, 0, 246, 0, 247, 0, 248, 249, 0, 250, 0, 0, 0, 0,
+		0, 0, 0, 251, 252, 253, 0, 0, 0, 0, 0, 0, 254, 255, 0, 256, 257, 258, 259, 260, 0, 0, 0, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+		0, 0, 270, 271, 0, 0, 0, 272, 273, 0, 274, 275, 276, 277, 278, 0, 279, 0, 280, 0, 281, 282, 283, 0, 0, 0, 0, 0, 0, 0, 284, 0,
+		0, 0, 0, 0, 285, 0, 0, 286, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 287, 288, 0, 0, 0, 289, 0, 0, 0, 290, 291, 292, 293, 294, 295, 0, 0, 296, 297, 298, 299, 300, 301, 0, 0,
+		0, 0, 0, 0, 0, 302, 303, 304, 305, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		307, 308, 309, 310, 311, 0, 312, 313, 314, 0, 315, 316, 317, 0, 0, 318, 0, 319, 0, 0, 0, 0, 0, 0, 320, 321, 0, 0, 0, 0, 0, 0,
+		0, 322, 323, 0, 0, 0, 0, 324, 325, 0, 326, 327, 0, 0, 0, 328, 0, 0, 0, 0, 0, 329, 330, 331, 332, 0, 333, 334, 335, 336, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 338, 0, 339, 340, 341, 0, 342, 0, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 0, 0, 357, 0,
+		358, 359, 0, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 0,
+		388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 0, 403, 404, 405, 0, 0, 406, 407, 0, 0, 0, 408, 0, 409, 410, 411, 0,
+		412, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 414, 0, 0, 415, 0, 416, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 0, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446,
+		447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478,
+		479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 0, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 0, 507, 508,
+		509, 510, 511, 0, 512, 513, 514, 515, 516, 517, 518, 0, 519, 520, 521, 522, 523, 524, 525, 0, 526, 0, 0, 0, 527, 528, 529, 530, 531, 532, 533, 534,
+		535, 536, 537, 0, 0, 0, 0, 0, 538, 539, 0, 0, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+		560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+		592, 0, 0, 593, 594, 0, 0, 595, 596, 0, 0, 597, 598, 0, 0, 0, 0, 0, 0, 0, 599, 600, 0, 0, 601, 602, 0, 0, 0, 0, 0, 0,
+		603, 604, 0, 0, 0, 0, 0, 0, 605, 606, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 607, 608, 609, 610, 611, 612, 613, 614, 615, 0, 0, 0, 0, 0, 0, 0, 0, 616, 617, 618, 619, 0, 0, 0, 0, 620, 621, 622, 623, 0,
+		624, 625, 626, 0, 0, 627, 628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 630, 631, 632, 633, 634, 0, 0, 0, 635, 636, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 637, 0, 0, 0, 0, 0, 0, 0, 638,
+		639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 640, 0, 0, 0, 0, 641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 643, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 644, 0, 0, 0, 0, 0, 0, 0, 645, 646, 647, 648, 0, 649, 650, 651, 652, 653, 0, 654, 655, 0, 656, 657, 658, 659, 660, 661, 662, 0,
+		0, 0, 663, 0, 664, 0, 665, 666, 667, 668, 0, 669, 670, 671, 0, 672, 673, 674, 0, 675, 676, 677, 678, 679, 680, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 0,
+		708, 0, 709, 710, 0, 0, 711, 0, 0, 712, 713, 714, 715, 716, 717, 0, 718, 719, 0, 720, 0, 0, 721, 722, 0, 0, 723, 724, 725, 726, 727, 728,
+		729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 0, 0, 0, 0, 751, 752, 0, 753, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		755, 756, 757, 758, 759, 760, 0, 761, 762, 763, 0, 764, 765, 0, 0, 766, 767, 768, 0, 769, 770, 0, 771, 772, 773, 774, 775, 0, 0, 776, 777, 778,
+		779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 0, 801, 802, 0, 803, 804, 805, 806, 807, 0,
+		808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 0, 832, 833, 834, 835, 0, 0, 836,
+		837, 838, 839, 0, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867,
+		868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 0, 0, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 0, 894, 895, 896,
+		897, 898, 899, 900, 901, 902, 0, 903, 904, 905, 906, 907, 908, 909, 910, 911, 0, 0, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 0, 0, 922, 0,
+		923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 0, 944, 945, 946, 947, 948, 949, 0, 0, 950, 951,
+		0, 0, 952, 953, 0, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 967, 968, 0, 969, 970, 971, 972, 0, 0, 0, 0, 0, 0, 0, 0, 0, 973, 974, 0, 0, 0, 0, 0, 975, 976, 977, 978,
+		0, 0, 979, 980, 0, 0, 0, 0, 0, 981, 982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 986, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1000, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1002, 1003, 0, 0, 0, 0, 0, 0, 0, 0, 1004, 0, 0, 1005, 0, 1006, 0, 1007, 1008, 1009, 1010, 1011, 0, 0, 1012, 1013, 0, 0, 1014, 1015, 1016, 1017,
+		0, 0, 1018, 1019, 0, 0, 1020, 0, 0, 0, 1021, 1022, 0, 0, 0, 1023, 1024, 1025, 1026, 0, 0, 0, 0, 1027, 1028, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1029, 1030, 0, 1031, 0, 0, 0, 0, 1032, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 1033, 1034, 0, 0, 0, 0, 0, 0, 0, 1035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1036, 0, 0, 1037, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1038, 1039,
+		1040, 0, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1059, 0, 1060, 1061, 0, 1062, 1063, 0, 0, 1064, 1065, 0, 0, 1066, 1067, 1068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 1069, 1070, 1071, 1072, 0, 1073, 1074, 1075, 1076, 0, 0, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096,
+		1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 0, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
+		1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 0, 1140, 0, 1141, 1142, 1143, 1144, 0, 0, 0, 1145, 0, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 0,
+		0, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
+		1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 0, 0, 0, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
+		1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 0, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1229, 1230, 1231, 1232, 1233, 1234, 0, 1235, 0, 0, 1236,
+	},
+	{
+		0, 0, 0, 0, 0, 1237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1238, 1239, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 0, 0, 0, 0, 0, 0, 0, 0, 1248, 0, 0, 1249, 1250, 0, 0, 0, 0, 0, 0, 0, 0,
+		1251, 1252, 1253, 0, 1254, 0, 0, 1255, 0, 0, 0, 0, 0, 0, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
+		1274, 1275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1276, 1277, 1278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1279, 1280, 0, 0,
+		1281, 0, 0, 0, 0, 1282, 1283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1284, 1285, 0, 0, 0, 0, 1286, 0, 0, 1287, 0, 0, 0,
+		1288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1289, 1290, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1291, 1292, 0, 0, 0, 1293, 1294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1295, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1296, 0, 0, 0, 0, 0, 0, 0, 0, 1297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 1298, 1299, 1300, 1301, 1302, 0, 0, 0, 0, 1303, 0, 1304, 1305, 0, 0, 0, 0, 0, 1306, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1307, 0, 0, 0, 0, 1308, 0, 0, 1309, 1310, 1311, 0, 0, 0, 0, 1312, 1313, 0, 0, 0, 0, 0, 0, 1314, 0, 0, 1315,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1316, 1317, 1318, 1319, 0, 0, 0, 0, 0, 0, 0, 1320, 1321,
+		0, 0, 0, 1322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1323, 0, 0, 0, 0, 0, 0, 1324, 0, 0, 0, 0, 0, 0, 0, 1325, 1326, 0,
+		0, 0, 0, 0, 0, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 0, 0, 0, 0, 0, 0, 0, 0, 1335, 1336, 0, 0, 0, 0, 0, 0, 1337, 1338, 0,
+		0, 1339, 1340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1341, 1342, 0, 0, 0, 0, 1343, 1344, 1345, 1346, 1347, 1348, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1349, 1350, 0, 0, 0, 0, 1351, 1352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1354, 0, 0, 0, 0, 0, 0, 1355, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1356, 1357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1358, 1359, 1360, 1361, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+		1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425,
+		1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 0, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+		1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+		1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 0, 1518, 1519,
+		0, 0, 1520, 0, 0, 1521, 1522, 0, 0, 1523, 1524, 1525, 1526, 0, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 0, 1539, 0, 1540, 1541, 1542,
+		1543, 1544, 1545, 1546, 0, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+		1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
+	},
+	{
+		1606, 1607, 1608, 1609, 1610, 1611, 0, 1612, 1613, 1614, 1615, 0, 0, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 0, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 0, 1631, 1632,
+		1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 0, 1659, 1660, 1661, 1662, 0,
+		1663, 1664, 1665, 1666, 1667, 0, 1668, 0, 0, 0, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 0, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689,
+		1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721,
+		1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+		1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+		1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+		1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+	},
+	{
+		1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
+		1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
+		1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
+		1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+		1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
+		2010, 2011, 2012, 2013, 0, 0, 0, 0, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 0, 0, 2025, 0, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+		2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 0, 0, 2048, 0, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+		2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 0, 0, 2077, 0, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092,
+	},
+	{
+		2093, 2094, 2095, 2096, 2097, 2098, 2099, 0, 0, 2100, 0, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121,
+		2122, 2123, 2124, 2125, 2126, 2127, 2128, 0, 0, 2129, 0, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150,
+		2151, 0, 0, 2152, 0, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179,
+		2180, 0, 0, 2181, 0, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 0, 0, 2204, 0, 2205,
+		2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 0, 0, 2233, 0, 2234,
+		2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 0, 0, 2256, 0, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+		2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 0, 0, 0, 0, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291,
+		2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323,
+	},
+	{
+		2324, 2325, 2326, 2327, 2328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+// canonical compositions of a base character and a combining mark (U+0300..U+036F),
+// sorted by base and mark; generated from the Unicode 14.0.0 character database
+const unicode_latex::Composition unicode_latex::compTable[] = {
+	{0x003C, 0x0338, 0x226E}, {0x003D, 0x0338, 0x2260}, {0x003E, 0x0338, 0x226F}, {0x0041, 0x0300, 0x00C0},
+	{0x0041, 0x0301, 0x00C1}, {0x0041, 0x0302, 0x00C2}, {0x0041, 0x0303, 0x00C3}, {0x0041, 0x0304, 0x0100},
+	{0x0041, 0x0306, 0x0102}, {0x0041, 0x0307, 0x0226}, {0x0041, 0x0308, 0x00C4}, {0x0041, 0x0309, 0x1EA2},
+	{0x0041, 0x030A, 0x00C5}, {0x0041, 0x030C, 0x01CD}, {0x0041, 0x030F, 0x0200}, {0x0041, 0x0311, 0x0202},
+	{0x0041, 0x0323, 0x1EA0}, {0x0041, 0x0325, 0x1E00}, {0x0041, 0x0328, 0x0104}, {0x0042, 0x0307, 0x1E02},
+	{0x0042, 0x0323, 0x1E04}, {0x0042, 0x0331, 0x1E06}, {0x0043, 0x0301, 0x0106}, {0x0043, 0x0302, 0x0108},
+	{0x0043, 0x0307, 0x010A}, {0x0043, 0x030C, 0x010C}, {0x0043, 0x0327, 0x00C7}, {0x0044, 0x0307, 0x1E0A},
+	{0x0044, 0x030C, 0x010E}, {0x0044, 0x0323, 0x1E0C}, {0x0044, 0x0327, 0x1E10}, {0x0044, 0x032D, 0x1E12},
+	{0x0044, 0x0331, 0x1E0E}, {0x0045, 0x0300, 0x00C8}, {0x0045, 0x0301, 0x00C9}, {0x0045, 0x0302, 0x00CA},
+	{0x0045, 0x0303, 0x1EBC}, {0x0045, 0x0304, 0x0112}, {0x0045, 0x0306, 0x0114}, {0x0045, 0x0307, 0x0116},
+	{0x0045, 0x0308, 0x00CB}, {0x0045, 0x0309, 0x1EBA}, {0x0045, 0x030C, 0x011A}, {0x0045, 0x030F, 0x0204},
+	{0x0045, 0x0311, 0x0206}, {0x0045, 0x0323, 0x1EB8}, {0x0045, 0x0327, 0x0228}, {0x0045, 0x0328, 0x0118},
+	{0x0045, 0x032D, 0x1E18}, {0x0045, 0x0330, 0x1E1A}, {0x0046, 0x0307, 0x1E1E}, {0x0047, 0x0301, 0x01F4},
+	{0x0047, 0x0302, 0x011C}, {0x0047, 0x0304, 0x1E20}, {0x0047, 0x0306, 0x011E}, {0x0047, 0x0307, 0x0120},
+	{0x0047, 0x030C, 0x01E6}, {0x0047, 0x0327, 0x0122}, {0x0048, 0x0302, 0x0124}, {0x0048, 0x0307, 0x1E22},
+	{0x0048, 0x0308, 0x1E26}, {0x0048, 0x030C, 0x021E}, {0x0048, 0x0323, 0x1E24}, {0x0048, 0x0327, 0x1E28},
+	{0x0048, 0x032E, 0x1E2A}, {0x0049, 0x0300, 0x00CC}, {0x0049, 0x0301, 0x00CD}, {0x0049, 0x0302, 0x00CE},
+	{0x0049, 0x0303, 0x0128}, {0x0049, 0x0304, 0x012A}, {0x0049, 0x0306, 0x012C}, {0x0049, 0x0307, 0x0130},
+	{0x0049, 0x0308, 0x00CF}, {0x0049, 0x0309, 0x1EC8}, {0x0049, 0x030C, 0x01CF}, {0x0049, 0x030F, 0x0208},
+	{0x0049, 0x0311, 0x020A}, {0x0049, 0x0323, 0x1ECA}, {0x0049, 0x0328, 0x012E}, {0x0049, 0x0330, 0x1E2C},
+	{0x004A, 0x0302, 0x0134}, {0x004B, 0x0301, 0x1E30}, {0x004B, 0x030C, 0x01E8}, {0x004B, 0x0323, 0x1E32},
+	{0x004B, 0x0327, 0x0136}, {0x004B, 0x0331, 0x1E34}, {0x004C, 0x0301, 0x0139}, {0x004C, 0x030C, 0x013D},
+	{0x004C, 0x0323, 0x1E36}, {0x004C, 0x0327, 0x013B}, {0x004C, 0x032D, 0x1E3C}, {0x004C, 0x0331, 0x1E3A},
+	{0x004D, 0x0301, 0x1E3E}, {0x004D, 0x0307, 0x1E40}, {0x004D, 0x0323, 0x1E42}, {0x004E, 0x0300, 0x01F8},
+	{0x004E, 0x0301, 0x0143}, {0x004E, 0x0303, 0x00D1}, {0x004E, 0x0307, 0x1E44}, {0x004E, 0x030C, 0x0147},
+	{0x004E, 0x0323, 0x1E46}, {0x004E, 0x0327, 0x0145}, {0x004E, 0x032D, 0x1E4A}, {0x004E, 0x0331, 0x1E48},
+	{0x004F, 0x0300, 0x00D2}, {0x004F, 0x0301, 0x00D3}, {0x004F, 0x0302, 0x00D4}, {0x004F, 0x0303, 0x00D5},
+	{0x004F, 0x0304, 0x014C}, {0x004F, 0x0306, 0x014E}, {0x004F, 0x0307, 0x022E}, {0x004F, 0x0308, 0x00D6},
+	{0x004F, 0x0309, 0x1ECE}, {0x004F, 0x030B, 0x0150}, {0x004F, 0x030C, 0x01D1}, {0x004F, 0x030F, 0x020C},
+	{0x004F, 0x0311, 0x020E}, {0x004F, 0x031B, 0x01A0}, {0x004F, 0x0323, 0x1ECC}, {0x004F, 0x0328, 0x01EA},
+	{0x0050, 0x0301, 0x1E54}, {0x0050, 0x0307, 0x1E56}, {0x0052, 0x0301, 0x0154}, {0x0052, 0x0307, 0x1E58},
+	{0x0052, 0x030C, 0x0158}, {0x0052, 0x030F, 0x0210}, {0x0052, 0x0311, 0x0212}, {0x0052, 0x0323, 0x1E5A},
+	{0x0052, 0x0327, 0x0156}, {0x0052, 0x0331, 0x1E5E}, {0x0053, 0x0301, 0x015A}, {0x0053, 0x0302, 0x015C},
+	{0x0053, 0x0307, 0x1E60}, {0x0053, 0x030C, 0x0160}, {0x0053, 0x0323, 0x1E62}, {0x0053, 0x0326, 0x0218},
+	{0x0053, 0x0327, 0x015E}, {0x0054, 0x0307, 0x1E6A}, {0x0054, 0x030C, 0x0164}, {0x0054, 0x0323, 0x1E6C},
+	{0x0054, 0x0326, 0x021A}, {0x0054, 0x0327, 0x0162}, {0x0054, 0x032D, 0x1E70}, {0x0054, 0x0331, 0x1E6E},
+	{0x0055, 0x0300, 0x00D9}, {0x0055, 0x0301, 0x00DA}, {0x0055, 0x0302, 0x00DB}, {0x0055, 0x0303, 0x0168},
+	{0x0055, 0x0304, 0x016A}, {0x0055, 0x0306, 0x016C}, {0x0055, 0x0308, 0x00DC}, {0x0055, 0x0309, 0x1EE6},
+	{0x0055, 0x030A, 0x016E}, {0x0055, 0x030B, 0x0170}, {0x0055, 0x030C, 0x01D3}, {0x0055, 0x030F, 0x0214},
+	{0x0055, 0x0311, 0x0216}, {0x0055, 0x031B, 0x01AF}, {0x0055, 0x0323, 0x1EE4}, {0x0055, 0x0324, 0x1E72},
+	{0x0055, 0x0328, 0x0172}, {0x0055, 0x032D, 0x1E76}, {0x0055, 0x0330, 0x1E74}, {0x0056, 0x0303, 0x1E7C},
+	{0x0056, 0x0323, 0x1E7E}, {0x0057, 0x0300, 0x1E80}, {0x0057, 0x0301, 0x1E82}, {0x0057, 0x0302, 0x0174},
+	{0x0057, 0x0307, 0x1E86}, {0x0057, 0x0308, 0x1E84}, {0x0057, 0x0323, 0x1E88}, {0x0058, 0x0307, 0x1E8A},
+	{0x0058, 0x0308, 0x1E8C}, {0x0059, 0x0300, 0x1EF2}, {0x0059, 0x0301, 0x00DD}, {0x0059, 0x0302, 0x0176},
+	{0x0059, 0x0303, 0x1EF8}, {0x0059, 0x0304, 0x0232}, {0x0059, 0x0307, 0x1E8E}, {0x0059, 0x0308, 0x0178},
+	{0x0059, 0x0309, 0x1EF6}, {0x0059, 0x0323, 0x1EF4}, {0x005A, 0x0301, 0x0179}, {0x005A, 0x0302, 0x1E90},
+	{0x005A, 0x0307, 0x017B}, {0x005A, 0x030C, 0x017D}, {0x005A, 0x0323, 0x1E92}, {0x005A, 0x0331, 0x1E94},
+	{0x0061, 0x0300, 0x00E0}, {0x0061, 0x0301, 0x00E1}, {0x0061, 0x0302, 0x00E2}, {0x0061, 0x0303, 0x00E3},
+	{0x0061, 0x0304, 0x0101}, {0x0061, 0x0306, 0x0103}, {0x0061, 0x0307, 0x0227}, {0x0061, 0x0308, 0x00E4},
+	{0x0061, 0x0309, 0x1EA3}, {0x0061, 0x030A, 0x00E5}, {0x0061, 0x030C, 0x01CE}, {0x0061, 0x030F, 0x0201},
+	{0x0061, 0x0311, 0x0203}, {0x0061, 0x0323, 0x1EA1}, {0x0061, 0x0325, 0x1E01}, {0x0061, 0x0328, 0x0105},
+	{0x0062, 0x0307, 0x1E03}, {0x0062, 0x0323, 0x1E05}, {0x0062, 0x0331, 0x1E07}, {0x0063, 0x0301, 0x0107},
+	{0x0063, 0x0302, 0x0109}, {0x0063, 0x0307, 0x010B}, {0x0063, 0x030C, 0x010D}, {0x0063, 0x0327, 0x00E7},
+	{0x0064, 0x0307, 0x1E0B}, {0x0064, 0x030C, 0x010F}, {0x0064, 0x0323, 0x1E0D}, {0x0064, 0x0327, 0x1E11},
+	{0x0064, 0x032D, 0x1E13}, {0x0064, 0x0331, 0x1E0F}, {0x0065, 0x0300, 0x00E8}, {0x0065, 0x0301, 0x00E9},
+	{0x0065, 0x0302, 0x00EA}, {0x0065, 0x0303, 0x1EBD}, {0x0065, 0x0304, 0x0113}, {0x0065, 0x0306, 0x0115},
+	{0x0065, 0x0307, 0x0117}, {0x0065, 0x0308, 0x00EB}, {0x0065, 0x0309, 0x1EBB}, {0x0065, 0x030C, 0x011B},
+	{0x0065, 0x030F, 0x0205}, {0x0065, 0x0311, 0x0207}, {0x0065, 0x0323, 0x1EB9}, {0x0065, 0x0327, 0x0229},
+	{0x0065, 0x0328, 0x0119}, {0x0065, 0x032D, 0x1E19}, {0x0065, 0x0330, 0x1E1B}, {0x0066, 0x0307, 0x1E1F},
+	{0x0067, 0x0301, 0x01F5}, {0x0067, 0x0302, 0x011D}, {0x0067, 0x0304, 0x1E21}, {0x0067, 0x0306, 0x011F},
+	{0x0067, 0x0307, 0x0121}, {0x0067, 0x030C, 0x01E7}, {0x0067, 0x0327, 0x0123}, {0x0068, 0x0302, 0x0125},
+	{0x0068, 0x0307, 0x1E23}, {0x0068, 0x0308, 0x1E27}, {0x0068, 0x030C, 0x021F}, {0x0068, 0x0323, 0x1E25},
+	{0x0068, 0x0327, 0x1E29}, {0x0068, 0x032E, 0x1E2B}, {0x0068, 0x0331, 0x1E96}, {0x0069, 0x0300, 0x00EC},
+	{0x0069, 0x0301, 0x00ED}, {0x0069, 0x0302, 0x00EE}, {0x0069, 0x0303, 0x0129}, {0x0069, 0x0304, 0x012B},
+	{0x0069, 0x0306, 0x012D}, {0x0069, 0x0308, 0x00EF}, {0x0069, 0x0309, 0x1EC9}, {0x0069, 0x030C, 0x01D0},
+	{0x0069, 0x030F, 0x0209}, {0x0069, 0x0311, 0x020B}, {0x0069, 0x0323, 0x1ECB}, {0x0069, 0x0328, 0x012F},
+	{0x0069, 0x0330, 0x1E2D}, {0x006A, 0x0302, 0x0135}, {0x006A, 0x030C, 0x01F0}, {0x006B, 0x0301, 0x1E31},
+	{0x006B, 0x030C, 0x01E9}, {0x006B, 0x0323, 0x1E33}, {0x006B, 0x0327, 0x0137}, {0x006B, 0x0331, 0x1E35},
+	{0x006C, 0x0301, 0x013A}, {0x006C, 0x030C, 0x013E}, {0x006C, 0x0323, 0x1E37}, {0x006C, 0x0327, 0x013C},
+	{0x006C, 0x032D, 0x1E3D}, {0x006C, 0x0331, 0x1E3B}, {0x006D, 0x0301, 0x1E3F}, {0x006D, 0x0307, 0x1E41},
+	{0x006D, 0x0323, 0x1E43}, {0x006E, 0x0300, 0x01F9}, {0x006E, 0x0301, 0x0144}, {0x006E, 0x0303, 0x00F1},
+	{0x006E, 0x0307, 0x1E45}, {0x006E, 0x030C, 0x0148}, {0x006E, 0x0323, 0x1E47}, {0x006E, 0x0327, 0x0146},
+	{0x006E, 0x032D, 0x1E4B}, {0x006E, 0x0331, 0x1E49}, {0x006F, 0x0300, 0x00F2}, {0x006F, 0x0301, 0x00F3},
+	{0x006F, 0x0302, 0x00F4}, {0x006F, 0x0303, 0x00F5}, {0x006F, 0x0304, 0x014D}, {0x006F, 0x0306, 0x014F},
+	{0x006F, 0x0307, 0x022F}, {0x006F, 0x0308, 0x00F6}, {0x006F, 0x0309, 0x1ECF}, {0x006F, 0x030B, 0x0151},
+	{0x006F, 0x030C, 0x01D2}, {0x006F, 0x030F, 0x020D}, {0x006F, 0x0311, 0x020F}, {0x006F, 0x031B, 0x01A1},
+	{0x006F, 0x0323, 0x1ECD}, {0x006F, 0x0328, 0x01EB}, {0x0070, 0x0301, 0x1E55}, {0x0070, 0x0307, 0x1E57},
+	{0x0072, 0x0301, 0x0155}, {0x0072, 0x0307, 0x1E59}, {0x0072, 0x030C, 0x0159}, {0x0072, 0x030F, 0x0211},
+	{0x0072, 0x0311, 0x0213}, {0x0072, 0x0323, 0x1E5B}, {0x0072, 0x0327, 0x0157}, {0x0072, 0x0331, 0x1E5F},
+	{0x0073, 0x0301, 0x015B}, {0x0073, 0x0302, 0x015D}, {0x0073, 0x0307, 0x1E61}, {0x0073, 0x030C, 0x0161},
+	{0x0073, 0x0323, 0x1E63}, {0x0073, 0x0326, 0x0219}, {0x0073, 0x0327, 0x015F}, {0x0074, 0x0307, 0x1E6B},
+	{0x0074, 0x0308, 0x1E97}, {0x0074, 0x030C, 0x0165}, {0x0074, 0x0323, 0x1E6D}, {0x0074, 0x0326, 0x021B},
+	{0x0074, 0x0327, 0x0163}, {0x0074, 0x032D, 0x1E71}, {0x0074, 0x0331, 0x1E6F}, {0x0075, 0x0300, 0x00F9},
+	{0x0075, 0x0301, 0x00FA}, {0x0075, 0x0302, 0x00FB}, {0x0075, 0x0303, 0x0169}, {0x0075, 0x0304, 0x016B},
+	{0x0075, 0x0306, 0x016D}, {0x0075, 0x0308, 0x00FC}, {0x0075, 0x0309, 0x1EE7}, {0x0075, 0x030A, 0x016F},
+	{0x0075, 0x030B, 0x0171}, {0x0075, 0x030C, 0x01D4}, {0x0075, 0x030F, 0x0215}, {0x0075, 0x0311, 0x0217},
+	{0x0075, 0x031B, 0x01B0}, {0x0075, 0x0323, 0x1EE5}, {0x0075, 0x0324, 0x1E73}, {0x0075, 0x0328, 0x0173},
+	{0x0075, 0x032D, 0x1E77}, {0x0075, 0x0330, 0x1E75}, {0x0076, 0x0303, 0x1E7D}, {0x0076, 0x0323, 0x1E7F},
+	{0x0077, 0x0300, 0x1E81}, {0x0077, 0x0301, 0x1E83}, {0x0077, 0x0302, 0x0175}, {0x0077, 0x0307, 0x1E87},
+	{0x0077, 0x0308, 0x1E85}, {0x0077, 0x030A, 0x1E98}, {0x0077, 0x0323, 0x1E89}, {0x0078, 0x0307, 0x1E8B},
+	{0x0078, 0x0308, 0x1E8D}, {0x0079, 0x0300, 0x1EF3}, {0x0079, 0x0301, 0x00FD}, {0x0079, 0x0302, 0x0177},
+	{0x0079, 0x0303, 0x1EF9}, {0x0079, 0x0304, 0x0233}, {0x0079, 0x0307, 0x1E8F}, {0x0079, 0x0308, 0x00FF},
+	{0x0079, 0x0309, 0x1EF7}, {0x0079, 0x030A, 0x1E99}, {0x0079, 0x0323, 0x1EF5}, {0x007A, 0x0301, 0x017A},
+	{0x007A, 0x0302, 0x1E91}, {0x007A, 0x0307, 0x017C}, {0x007A, 0x030C, 0x017E}, {0x007A, 0x0323, 0x1E93},
+	{0x007A, 0x0331, 0x1E95}, {0x00A8, 0x0300, 0x1FED}, {0x00A8, 0x0301, 0x0385}, {0x00A8, 0x0342, 0x1FC1},
+	{0x00C2, 0x0300, 0x1EA6}, {0x00C2, 0x0301, 0x1EA4}, {0x00C2, 0x0303, 0x1EAA}, {0x00C2, 0x0309, 0x1EA8},
+	{0x00C4, 0x0304, 0x01DE}, {0x00C5, 0x0301, 0x01FA}, {0x00C6, 0x0301, 0x01FC}, {0x00C6, 0x0304, 0x01E2},
+	{0x00C7, 0x0301, 0x1E08}, {0x00CA, 0x0300, 0x1EC0}, {0x00CA, 0x0301, 0x1EBE}, {0x00CA, 0x0303, 0x1EC4},
+	{0x00CA, 0x0309, 0x1EC2}, {0x00CF, 0x0301, 0x1E2E}, {0x00D4, 0x0300, 0x1ED2}, {0x00D4, 0x0301, 0x1ED0},
+	{0x00D4, 0x0303, 0x1ED6}, {0x00D4, 0x0309, 0x1ED4}, {0x00D5, 0x0301, 0x1E4C}, {0x00D5, 0x0304, 0x022C},
+	{0x00D5, 0x0308, 0x1E4E}, {0x00D6, 0x0304, 0x022A}, {0x00D8, 0x0301, 0x01FE}, {0x00DC, 0x0300, 0x01DB},
+	{0x00DC, 0x0301, 0x01D7}, {0x00DC, 0x0304, 0x01D5}, {0x00DC, 0x030C, 0x01D9}, {0x00E2, 0x0300, 0x1EA7},
+	{0x00E2, 0x0301, 0x1EA5}, {0x00E2, 0x0303, 0x1EAB}, {0x00E2, 0x0309, 0x1EA9}, {0x00E4, 0x0304, 0x01DF},
+	{0x00E5, 0x0301, 0x01FB}, {0x00E6, 0x0301, 0x01FD}, {0x00E6, 0x0304, 0x01E3}, {0x00E7, 0x0301, 0x1E09},
+	{0x00EA, 0x0300, 0x1EC1}, {0x00EA, 0x0301, 0x1EBF}, {0x00EA, 0x0303, 0x1EC5}, {0x00EA, 0x0309, 0x1EC3},
+	{0x00EF, 0x0301, 0x1E2F}, {0x00F4, 0x0300, 0x1ED3}, {0x00F4, 0x0301, 0x1ED1}, {0x00F4, 0x0303, 0x1ED7},
+	{0x00F4, 0x0309, 0x1ED5}, {0x00F5, 0x0301, 0x1E4D}, {0x00F5, 0x0304, 0x022D}, {0x00F5, 0x0308, 0x1E4F},
+	{0x00F6, 0x0304, 0x022B}, {0x00F8, 0x0301, 0x01FF}, {0x00FC, 0x0300, 0x01DC}, {0x00FC, 0x0301, 0x01D8},
+	{0x00FC, 0x0304, 0x01D6}, {0x00FC, 0x030C, 0x01DA}, {0x0102, 0x0300, 0x1EB0}, {0x0102, 0x0301, 0x1EAE},
+	{0x0102, 0x0303, 0x1EB4}, {0x0102, 0x0309, 0x1EB2}, {0x0103, 0x0300, 0x1EB1}, {0x0103, 0x0301, 0x1EAF},
+	{0x0103, 0x0303, 0x1EB5}, {0x0103, 0x0309, 0x1EB3}, {0x0112, 0x0300, 0x1E14}, {0x0112, 0x0301, 0x1E16},
+	{0x0113, 0x0300, 0x1E15}, {0x0113, 0x0301, 0x1E17}, {0x014C, 0x0300, 0x1E50}, {0x014C, 0x0301, 0x1E52},
+	{0x014D, 0x0300, 0x1E51}, {0x014D, 0x0301, 0x1E53}, {0x015A, 0x0307, 0x1E64}, {0x015B, 0x0307, 0x1E65},
+	{0x0160, 0x0307, 0x1E66}, {0x0161, 0x0307, 0x1E67}, {0x0168, 0x0301, 0x1E78}, {0x0169, 0x0301, 0x1E79},
+	{0x016A, 0x0308, 0x1E7A}, {0x016B, 0x0308, 0x1E7B}, {0x017F, 0x0307, 0x1E9B}, {0x01A0, 0x0300, 0x1EDC},
+	{0x01A0, 0x0301, 0x1EDA}, {0x01A0, 0x0303, 0x1EE0}, {0x01A0, 0x0309, 0x1EDE}, {0x01A0, 0x0323, 0x1EE2},
+	{0x01A1, 0x0300, 0x1EDD}, {0x01A1, 0x0301, 0x1EDB}, {0x01A1, 0x0303, 0x1EE1}, {0x01A1, 0x0309, 0x1EDF},
+	{0x01A1, 0x0323, 0x1EE3}, {0x01AF, 0x0300, 0x1EEA}, {0x01AF, 0x0301, 0x1EE8}, {0x01AF, 0x0303, 0x1EEE},
+	{0x01AF, 0x0309, 0x1EEC}, {0x01AF, 0x0323, 0x1EF0}, {0x01B0, 0x0300, 0x1EEB}, {0x01B0, 0x0301, 0x1EE9},
+	{0x01B0, 0x0303, 0x1EEF}, {0x01B0, 0x0309, 0x1EED}, {0x01B0, 0x0323, 0x1EF1}, {0x01B7, 0x030C, 0x01EE},
+	{0x01EA, 0x0304, 0x01EC}, {0x01EB, 0x0304, 0x01ED}, {0x0226, 0x0304, 0x01E0}, {0x0227, 0x0304, 0x01E1},
+	{0x0228, 0x0306, 0x1E1C}, {0x0229, 0x0306, 0x1E1D}, {0x022E, 0x0304, 0x0230}, {0x022F, 0x0304, 0x0231},
+	{0x0292, 0x030C, 0x01EF}, {0x0391, 0x0300, 0x1FBA}, {0x0391, 0x0301, 0x0386}, {0x0391, 0x0304, 0x1FB9},
+	{0x0391, 0x0306, 0x1FB8}, {0x0391, 0x0313, 0x1F08}, {0x0391, 0x0314, 0x1F09}, {0x0391, 0x0345, 0x1FBC},
+	{0x0395, 0x0300, 0x1FC8}, {0x0395, 0x0301, 0x0388}, {0x0395, 0x0313, 0x1F18}, {0x0395, 0x0314, 0x1F19},
+	{0x0397, 0x0300, 0x1FCA}, {0x0397, 0x0301, 0x0389}, {0x0397, 0x0313, 0x1F28}, {0x0397, 0x0314, 0x1F29},
+	{0x0397, 0x0345, 0x1FCC}, {0x0399, 0x0300, 0x1FDA}, {0x0399, 0x0301, 0x038A}, {0x0399, 0x0304, 0x1FD9},
+	{0x0399, 0x0306, 0x1FD8}, {0x0399, 0x0308, 0x03AA}, {0x0399, 0x0313, 0x1F38}, {0x0399, 0x0314, 0x1F39},
+	{0x039F, 0x0300, 0x1FF8}, {0x039F, 0x0301, 0x038C}, {0x039F, 0x0313, 0x1F48}, {0x039F, 0x0314, 0x1F49},
+	{0x03A1, 0x0314, 0x1FEC}, {0x03A5, 0x0300, 0x1FEA}, {0x03A5, 0x0301, 0x038E}, {0x03A5, 0x0304, 0x1FE9},
+	{0x03A5, 0x0306, 0x1FE8}, {0x03A5, 0x0308, 0x03AB}, {0x03A5, 0x0314, 0x1F59}, {0x03A9, 0x0300, 0x1FFA},
+	{0x03A9, 0x0301, 0x038F}, {0x03A9, 0x0313, 0x1F68}, {0x03A9, 0x0314, 0x1F69}, {0x03A9, 0x0345, 0x1FFC},
+	{0x03AC, 0x0345, 0x1FB4}, {0x03AE, 0x0345, 0x1FC4}, {0x03B1, 0x0300, 0x1F70}, {0x03B1, 0x0301, 0x03AC},
+	{0x03B1, 0x0304, 0x1FB1}, {0x03B1, 0x0306, 0x1FB0}, {0x03B1, 0x0313, 0x1F00}, {0x03B1, 0x0314, 0x1F01},
+	{0x03B1, 0x0342, 0x1FB6}, {0x03B1, 0x0345, 0x1FB3}, {0x03B5, 0x0300, 0x1F72}, {0x03B5, 0x0301, 0x03AD},
+	{0x03B5, 0x0313, 0x1F10}, {0x03B5, 0x0314, 0x1F11}, {0x03B7, 0x0300, 0x1F74}, {0x03B7, 0x0301, 0x03AE},
+	{0x03B7, 0x0313, 0x1F20}, {0x03B7, 0x0314, 0x1F21}, {0x03B7, 0x0342, 0x1FC6}, {0x03B7, 0x0345, 0x1FC3},
+	{0x03B9, 0x0300, 0x1F76}, {0x03B9, 0x0301, 0x03AF}, {0x03B9, 0x0304, 0x1FD1}, {0x03B9, 0x0306, 0x1FD0},
+	{0x03B9, 0x0308, 0x03CA}, {0x03B9, 0x0313, 0x1F30}, {0x03B9, 0x0314, 0x1F31}, {0x03B9, 0x0342, 0x1FD6},
+	{0x03BF, 0x0300, 0x1F78}, {0x03BF, 0x0301, 0x03CC}, {0x03BF, 0x0313, 0x1F40}, {0x03BF, 0x0314, 0x1F41},
+	{0x03C1, 0x0313, 0x1FE4}, {0x03C1, 0x0314, 0x1FE5}, {0x03C5, 0x0300, 0x1F7A}, {0x03C5, 0x0301, 0x03CD},
+	{0x03C5, 0x0304, 0x1FE1}, {0x03C5, 0x0306, 0x1FE0}, {0x03C5, 0x0308, 0x03CB}, {0x03C5, 0x0313, 0x1F50},
+	{0x03C5, 0x0314, 0x1F51}, {0x03C5, 0x0342, 0x1FE6}, {0x03C9, 0x0300, 0x1F7C}, {0x03C9, 0x0301, 0x03CE},
+	{0x03C9, 0x0313, 0x1F60}, {0x03C9, 0x0314, 0x1F61}, {0x03C9, 0x0342, 0x1FF6}, {0x03C9, 0x0345, 0x1FF3},
+	{0x03CA, 0x0300, 0x1FD2}, {0x03CA, 0x0301, 0x0390}, {0x03CA, 0x0342, 0x1FD7}, {0x03CB, 0x0300, 0x1FE2},
+	{0x03CB, 0x0301, 0x03B0}, {0x03CB, 0x0342, 0x1FE7}, {0x03CE, 0x0345, 0x1FF4}, {0x03D2, 0x0301, 0x03D3},
+	{0x03D2, 0x0308, 0x03D4}, {0x0406, 0x0308, 0x0407}, {0x0410, 0x0306, 0x04D0}, {0x0410, 0x0308, 0x04D2},
+	{0x0413, 0x0301, 0x0403}, {0x0415, 0x0300, 0x0400}, {0x0415, 0x0306, 0x04D6}, {0x0415, 0x0308, 0x0401},
+	{0x0416, 0x0306, 0x04C1}, {0x0416, 0x0308, 0x04DC}, {0x0417, 0x0308, 0x04DE}, {0x0418, 0x0300, 0x040D},
+	{0x0418, 0x0304, 0x04E2}, {0x0418, 0x0306, 0x0419}, {0x0418, 0x0308, 0x04E4}, {0x041A, 0x0301, 0x040C},
+	{0x041E, 0x0308, 0x04E6}, {0x0423, 0x0304, 0x04EE}, {0x0423, 0x0306, 0x040E}, {0x0423, 0x0308, 0x04F0},
+	{0x0423, 0x030B, 0x04F2}, {0x0427, 0x0308, 0x04F4}, {0x042B, 0x0308, 0x04F8}, {0x042D, 0x0308, 0x04EC},
+	{0x0430, 0x0306, 0x04D1}, {0x0430, 0x0308, 0x04D3}, {0x0433, 0x0301, 0x0453}, {0x0435, 0x0300, 0x0450},
+	{0x0435, 0x0306, 0x04D7}, {0x0435, 0x0308, 0x0451}, {0x0436, 0x0306, 0x04C2}, {0x0436, 0x0308, 0x04DD},
+	{0x0437, 0x0308, 0x04DF}, {0x0438, 0x0300, 0x045D}, {0x0438, 0x0304, 0x04E3}, {0x0438, 0x0306, 0x0439},
+	{0x0438, 0x0308, 0x04E5}, {0x043A, 0x0301, 0x045C}, {0x043E, 0x0308, 0x04E7}, {0x0443, 0x0304, 0x04EF},
+	{0x0443, 0x0306, 0x045E}, {0x0443, 0x0308, 0x04F1}, {0x0443, 0x030B, 0x04F3}, {0x0447, 0x0308, 0x04F5},
+	{0x044B, 0x0308, 0x04F9}, {0x044D, 0x0308, 0x04ED}, {0x0456, 0x0308, 0x0457}, {0x0474, 0x030F, 0x0476},
+	{0x0475, 0x030F, 0x0477}, {0x04D8, 0x0308, 0x04DA}, {0x04D9, 0x0308, 0x04DB}, {0x04E8, 0x0308, 0x04EA},
+	{0x04E9, 0x0308, 0x04EB}, {0x1E36, 0x0304, 0x1E38}, {0x1E37, 0x0304, 0x1E39}, {0x1E5A, 0x0304, 0x1E5C},
+	{0x1E5B, 0x0304, 0x1E5D}, {0x1E62, 0x0307, 0x1E68}, {0x1E63, 0x0307, 0x1E69}, {0x1EA0, 0x0302, 0x1EAC},
+	{0x1EA0, 0x0306, 0x1EB6}, {0x1EA1, 0x0302, 0x1EAD}, {0x1EA1, 0x0306, 0x1EB7}, {0x1EB8, 0x0302, 0x1EC6},
+	{0x1EB9, 0x0302, 0x1EC7}, {0x1ECC, 0x0302, 0x1ED8}, {0x1ECD, 0x0302, 0x1ED9}, {0x1F00, 0x0300, 0x1F02},
+	{0x1F00, 0x0301, 0x1F04}, {0x1F00, 0x0342, 0x1F06}, {0x1F00, 0x0345, 0x1F80}, {0x1F01, 0x0300, 0x1F03},
+	{0x1F01, 0x0301, 0x1F05}, {0x1F01, 0x0342, 0x1F07}, {0x1F01, 0x0345, 0x1F81}, {0x1F02, 0x0345, 0x1F82},
+	{0x1F03, 0x0345, 0x1F83}, {0x1F04, 0x0345, 0x1F84}, {0x1F05, 0x0345, 0x1F85}, {0x1F06, 0x0345, 0x1F86},
+	{0x1F07, 0x0345, 0x1F87}, {0x1F08, 0x0300, 0x1F0A}, {0x1F08, 0x0301, 0x1F0C}, {0x1F08, 0x0342, 0x1F0E},
+	{0x1F08, 0x0345, 0x1F88}, {0x1F09, 0x0300, 0x1F0B}, {0x1F09, 0x0301, 0x1F0D}, {0x1F09, 0x0342, 0x1F0F},
+	{0x1F09, 0x0345, 0x1F89}, {0x1F0A, 0x0345, 0x1F8A}, {0x1F0B, 0x0345, 0x1F8B}, {0x1F0C, 0x0345, 0x1F8C},
+	{0x1F0D, 0x0345, 0x1F8D}, {0x1F0E, 0x0345, 0x1F8E}, {0x1F0F, 0x0345, 0x1F8F}, {0x1F10, 0x0300, 0x1F12},
+	{0x1F10, 0x0301, 0x1F14}, {0x1F11, 0x0300, 0x1F13}, {0x1F11, 0x0301, 0x1F15}, {0x1F18, 0x0300, 0x1F1A},
+	{0x1F18, 0x0301, 0x1F1C}, {0x1F19, 0x0300, 0x1F1B}, {0x1F19, 0x0301, 0x1F1D}, {0x1F20, 0x0300, 0x1F22},
+	{0x1F20, 0x0301, 0x1F24}, {0x1F20, 0x0342, 0x1F26}, {0x1F20, 0x0345, 0x1F90}, {0x1F21, 0x0300, 0x1F23},
+	{0x1F21, 0x0301, 0x1F25}, {0x1F21, 0x0342, 0x1F27}, {0x1F21, 0x0345, 0x1F91}, {0x1F22, 0x0345, 0x1F92},
+	{0x1F23, 0x0345, 0x1F93}, {0x1F24, 0x0345, 0x1F94}, {0x1F25, 0x0345, 0x1F95}, {0x1F26, 0x0345, 0x1F96},
+	{0x1F27, 0x0345, 0x1F97}, {0x1F28, 0x0300, 0x1F2A}, {0x1F28, 0x0301, 0x1F2C}, {0x1F28, 0x0342, 0x1F2E},
+	{0x1F28, 0x0345, 0x1F98}, {0x1F29, 0x0300, 0x1F2B}, {0x1F29, 0x0301, 0x1F2D}, {0x1F29, 0x0342, 0x1F2F},
+	{0x1F29, 0x0345, 0x1F99}, {0x1F2A, 0x0345, 0x1F9A}, {0x1F2B, 0x0345, 0x1F9B}, {0x1F2C, 0x0345, 0x1F9C},
+	{0x1F2D, 0x0345, 0x1F9D}, {0x1F2E, 0x0345, 0x1F9E}, {0x1F2F, 0x0345, 0x1F9F}, {0x1F30, 0x0300, 0x1F32},
+	{0x1F30, 0x0301, 0x1F34}, {0x1F30, 0x0342, 0x1F36}, {0x1F31, 0x0300, 0x1F33}, {0x1F31, 0x0301, 0x1F35},
+	{0x1F31, 0x0342, 0x1F37}, {0x1F38, 0x0300, 0x1F3A}, {0x1F38, 0x0301, 0x1F3C}, {0x1F38, 0x0342, 0x1F3E},
+	{0x1F39, 0x0300, 0x1F3B}, {0x1F39, 0x0301, 0x1F3D}, {0x1F39, 0x0342, 0x1F3F}, {0x1F40, 0x0300, 0x1F42},
+	{0x1F40, 0x0301, 0x1F44}, {0x1F41, 0x0300, 0x1F43}, {0x1F41, 0x0301, 0x1F45}, {0x1F48, 0x0300, 0x1F4A},
+	{0x1F48, 0x0301, 0x1F4C}, {0x1F49, 0x0300, 0x1F4B}, {0x1F49, 0x0301, 0x1F4D}, {0x1F50, 0x0300, 0x1F52},
+	{0x1F50, 0x0301, 0x1F54}, {0x1F50, 0x0342, 0x1F56}, {0x1F51, 0x0300, 0x1F53}, {0x1F51, 0x0301, 0x1F55},
+	{0x1F51, 0x0342, 0x1F57}, {0x1F59, 0x0300, 0x1F5B}, {0x1F59, 0x0301, 0x1F5D}, {0x1F59, 0x0342, 0x1F5F},
+	{0x1F60, 0x0300, 0x1F62}, {0x1F60, 0x0301, 0x1F64}, {0x1F60, 0x0342, 0x1F66}, {0x1F60, 0x0345, 0x1FA0},
+	{0x1F61, 0x0300, 0x1F63}, {0x1F61, 0x0301, 0x1F65}, {0x1F61, 0x0342, 0x1F67}, {0x1F61, 0x0345, 0x1FA1},
+	{0x1F62, 0x0345, 0x1FA2}, {0x1F63, 0x0345, 0x1FA3}, {0x1F64, 0x0345, 0x1FA4}, {0x1F65, 0x0345, 0x1FA5},
+	{0x1F66, 0x0345, 0x1FA6}, {0x1F67, 0x0345, 0x1FA7}, {0x1F68, 0x0300, 0x1F6A}, {0x1F68, 0x0301, 0x1F6C},
+	{0x1F68, 0x0342, 0x1F6E}, {0x1F68, 0x0345, 0x1FA8}, {0x1F69, 0x0300, 0x1F6B}, {0x1F69, 0x0301, 0x1F6D},
+	{0x1F69, 0x0342, 0x1F6F}, {0x1F69, 0x0345, 0x1FA9}, {0x1F6A, 0x0345, 0x1FAA}, {0x1F6B, 0x0345, 0x1FAB},
+	{0x1F6C, 0x0345, 0x1FAC}, {0x1F6D, 0x0345, 0x1FAD}, {0x1F6E, 0x0345, 0x1FAE}, {0x1F6F, 0x0345, 0x1FAF},
+	{0x1F70, 0x0345, 0x1FB2}, {0x1F74, 0x0345, 0x1FC2}, {0x1F7C, 0x0345, 0x1FF2}, {0x1FB6, 0x0345, 0x1FB7},
+	{0x1FBF, 0x0300, 0x1FCD}, {0x1FBF, 0x0301, 0x1FCE}, {0x1FBF, 0x0342, 0x1FCF}, {0x1FC6, 0x0345, 0x1FC7},
+	{0x1FF6, 0x0345, 0x1FF7}, {0x1FFE, 0x0300, 0x1FDD}, {0x1FFE, 0x0301, 0x1FDE}, {0x1FFE, 0x0342, 0x1FDF},
+	{0x2190, 0x0338, 0x219A}, {0x2192, 0x0338, 0x219B}, {0x2194, 0x0338, 0x21AE}, {0x21D0, 0x0338, 0x21CD},
+	{0x21D2, 0x0338, 0x21CF}, {0x21D4, 0x0338, 0x21CE}, {0x2203, 0x0338, 0x2204}, {0x2208, 0x0338, 0x2209},
+	{0x220B, 0x0338, 0x220C}, {0x2223, 0x0338, 0x2224}, {0x2225, 0x0338, 0x2226}, {0x223C, 0x0338, 0x2241},
+	{0x2243, 0x0338, 0x2244}, {0x2245, 0x0338, 0x2247}, {0x2248, 0x0338, 0x2249}, {0x224D, 0x0338, 0x226D},
+	{0x2261, 0x0338, 0x2262}, {0x2264, 0x0338, 0x2270}, {0x2265, 0x0338, 0x2271}, {0x2272, 0x0338, 0x2274},
+	{0x2273, 0x0338, 0x2275}, {0x2276, 0x0338, 0x2278}, {0x2277, 0x0338, 0x2279}, {0x227A, 0x0338, 0x2280},
+	{0x227B, 0x0338, 0x2281}, {0x227C, 0x0338, 0x22E0}, {0x227D, 0x0338, 0x22E1}, {0x2282, 0x0338, 0x2284},
+	{0x2283, 0x0338, 0x2285}, {0x2286, 0x0338, 0x2288}, {0x2287, 0x0338, 0x2289}, {0x2291, 0x0338, 0x22E2},
+	{0x2292, 0x0338, 0x22E3}, {0x22A2, 0x0338, 0x22AC}, {0x22A8, 0x0338, 0x22AD}, {0x22A9, 0x0338, 0x22AE},
+	{0x22AB, 0x0338, 0x22AF}, {0x22B2, 0x0338, 0x22EA}, {0x22B3, 0x0338, 0x22EB}, {0x22B4, 0x0338, 0x22EC},
+	{0x22B5, 0x0338, 0x22ED},
+};
+
+const size_t unicode_latex::compCount = sizeof(compTable) / sizeof(compTable[0]);
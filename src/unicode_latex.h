@@ -1,17 +1,63 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <vector>
 
 using namespace std;
 
 class unicode_latex
 {
-	static const map<unsigned long, string> substMap;
-	static map<unsigned long, string> initMap();
+	struct Substitution
+	{
+		unsigned long code;
+		const char* latex;
+	};
+
+	// constant tables, no initialization at startup
+	static const Substitution substTable[];
+	static const size_t substCount;
+	static const unsigned char substPages[256];
+	static const unsigned short substSlots[][256];
+
+	// canonical compositions for the normalization of decomposed input
+	struct Composition
+	{
+		unsigned long base;
+		unsigned long mark;
+		unsigned long composed;
+	};
+
+	static const Composition compTable[];
+	static const size_t compCount;
+
+	static const char* find(unsigned long code);
+	static unsigned long findComposition(unsigned long base, unsigned long mark);
+	static bool decode(const char* s, size_t n, size_t& i, unsigned long& code);
+	static string fold(unsigned long code);
+	static size_t asciiLength(const char* s, size_t n);
+	static void appendUTF8(string& res, unsigned long code);
+
+	// trie of LaTeX commands for the reverse conversion
+	struct TrieNode
+	{
+		vector<pair<unsigned char, int> > next;
+		unsigned long code;
+		bool word;
+
+		TrieNode(): code(0), word(false) {}
+	};
+
+	static vector<TrieNode> buildTrie();
+	static void insertCommand(vector<TrieNode>& trie, const string& cmd, unsigned long code);
+	static bool matchCommand(const vector<TrieNode>& trie, const char* s, size_t n, size_t pos, size_t& end, unsigned long& code);
 
 public:
+	static bool isAscii(const string& s);
+	static string compose(const string& s);
+	// lowercased, accent-folded text without markup; punctuation is dropped unless kept
+	static string collationKey(const string& s, bool keepPunctuation = false);
 	static string transform(char c1, char c2);
 	static string transform(const string& s);
+	static string transformToUnicode(const string& s);
 };
 